@@ -56,6 +56,7 @@ extern "C" {
 #define CMPIVersion100 100  ///< CMPI 1.0.0
 #define CMPIVersion200 200  ///< CMPI 2.0.0
 #define CMPIVersion210 210  ///< CMPI 2.1.0
+#define CMPIVersion220 220  ///< CMPI 2.2.0
 
 /**
  * @}
@@ -73,7 +74,7 @@ extern "C" {
  * header files. See @ref sym-version "CMPI_VERSION" for implementing against
  * a lower CMPI version.
  */
-#define CMPICurrentVersion CMPIVersion210
+#define CMPICurrentVersion CMPIVersion220
 
 /**
  * @}
@@ -108,6 +109,11 @@ extern "C" {
 #  define CMPI_VER_100 1  ///< Check for features introduced in CMPI 1.0.0
 #  define CMPI_VER_200 1  ///< Check for features introduced in CMPI 2.0.0
 #  define CMPI_VER_210 1  ///< Check for features introduced in CMPI 2.1.0
+#elif (CMPI_VERSION == CMPIVersion220)
+#  define CMPI_VER_100 1  ///< Check for features introduced in CMPI 1.0.0
+#  define CMPI_VER_200 1  ///< Check for features introduced in CMPI 2.0.0
+#  define CMPI_VER_210 1  ///< Check for features introduced in CMPI 2.1.0
+#  define CMPI_VER_220 1  ///< Check for features introduced in CMPI 2.2.0
 #else
 #  error Unsupported CMPI version defined in CMPI_VERSION symbol
 #endif
@@ -128,6 +134,9 @@ struct _CMPIBrokerExtFT;
 #ifdef CMPI_VER_200
 struct _CMPIBrokerMemFT;
 #endif
+#ifdef CMPI_VER_220
+struct _CMPIBrokerAsyncFT;
+#endif
 typedef struct _CMPIBroker CMPIBroker;
 typedef struct _CMPIBrokerFT CMPIBrokerFT;
 typedef struct _CMPIBrokerEncFT CMPIBrokerEncFT;
@@ -135,6 +144,9 @@ typedef struct _CMPIBrokerExtFT CMPIBrokerExtFT;
 #ifdef CMPI_VER_200
 typedef struct _CMPIBrokerMemFT CMPIBrokerMemFT;
 #endif
+#ifdef CMPI_VER_220
+typedef struct _CMPIBrokerAsyncFT CMPIBrokerAsyncFT;
+#endif
 
 struct _CMPIContext;
 struct _CMPIResult;
@@ -156,6 +168,9 @@ struct _CMPIError;
 struct _CMPIPropertyList;
 struct _CMPIEnumerationFilter;
 #endif
+#ifdef CMPI_VER_220
+struct _CMPIFilterSet;
+#endif
 typedef struct _CMPIContext CMPIContext;
 typedef struct _CMPIResult CMPIResult;
 typedef struct _CMPIString CMPIString;
@@ -176,6 +191,9 @@ typedef struct _CMPIError CMPIError;
 typedef struct _CMPIPropertyList CMPIPropertyList;
 typedef struct _CMPIEnumerationFilter CMPIEnumerationFilter;
 #endif
+#ifdef CMPI_VER_220
+typedef struct _CMPIFilterSet CMPIFilterSet;
+#endif
 struct _CMPIContextFT;
 struct _CMPIResultFT;
 struct _CMPIStringFT;
@@ -198,6 +216,9 @@ struct _CMPIErrorFT;
 struct _CMPIPropertyListFT;
 struct _CMPIEnumerationFilterFT;
 #endif
+#ifdef CMPI_VER_220
+struct _CMPIFilterSetFT;
+#endif
 typedef struct _CMPIContextFT CMPIContextFT;
 typedef struct _CMPIResultFT CMPIResultFT;
 typedef struct _CMPIStringFT CMPIStringFT;
@@ -218,6 +239,9 @@ typedef struct _CMPIErrorFT CMPIErrorFT;
 typedef struct _CMPIPropertyListFT CMPIPropertyListFT;
 typedef struct _CMPIEnumerationFilterFT CMPIEnumerationFilterFT;
 #endif
+#ifdef CMPI_VER_220
+typedef struct _CMPIFilterSetFT CMPIFilterSetFT;
+#endif
 
 typedef struct _CMPIInstanceMIFT CMPIInstanceMIFT;
 typedef struct _CMPIAssociationMIFT CMPIAssociationMIFT;
@@ -768,6 +792,27 @@ typedef unsigned int CMPIFlags;
  */
 typedef int CMPIVersion;
 
+#ifdef CMPI_VER_220
+
+/**
+ * @}
+ * @addtogroup type-property-handle
+ * @{
+ */
+
+/**
+ * @brief An opaque type representing a resolved property name of a class.
+ *
+ * Property handles are obtained using CMPIBrokerEncFT.getPropertyHandle(),
+ * and are used with CMPIInstanceFT.getPropertyByHandle() and
+ * CMPIInstanceFT.setPropertyByHandle().
+ *
+ * @added220
+ */
+typedef const void* CMPIPropertyHandle;
+
+#endif /* CMPI_VER_220 */
+
 /**
  * @}
  * @addtogroup def-context-fieldnames
@@ -847,6 +892,29 @@ typedef int CMPIVersion;
  */
 #define CMPIContentLanguage "CMPIContentLanguage"
 
+#ifdef CMPI_VER_220
+/**
+ * @brief Page size requested by the MI for streaming enumerations.
+ *
+ * This entry is not set by the MB in the CMPIContext objects passed to MI
+ * functions. An MI may add it to the CMPIContext object that it passes to an
+ * MB function that returns a CMPIEnumeration object (e.g.
+ * CMPIBrokerFT.enumerateInstances() or CMPIBrokerFT.associators()), to
+ * request a streaming enumeration.
+ *
+ * If the value is greater than 0, the MB may return a streaming enumeration
+ * that retrieves the elements from the target MI in pages of at most that
+ * many elements, as they are consumed by the MI (see @ref edt-enumeration
+ * "CMPIEnumeration Support"). If the entry is not present or its value is 0,
+ * the MB returns a CMPIEnumeration object that has been fully populated.
+ *
+ * Type: @ref CMPI_uint32
+ *
+ * @added220
+ */
+#define CMPIStreamingPageSize "CMPIStreamingPageSize"
+#endif /* CMPI_VER_220 */
+
 /**
  * @}
  * @addtogroup type-rc
@@ -867,7 +935,7 @@ typedef int CMPIVersion;
  * @li `CMPI_RC_DO_NOT_UNLOAD` to `CMPI_RC_NEVER_UNLOAD`:@n
  *     Return codes used only by the MI `cleanup()` functions (e.g.
        CMPIInstanceMIFT.cleanup()).
- * @li `CMPI_RC_ERR_INVALID_HANDLE` to `CMPI_RC_ERR_NOT_IN_CODEPAGE`:@n
+ * @li `CMPI_RC_ERR_INVALID_HANDLE` to `CMPI_RC_ERR_ABORTED`:@n
  *     Return codes for other errors detected by CMPI.
  * @li `CMPI_RC_ERROR_SYSTEM` to `CMPI_RC_ERROR`:@n
  *     Return codes for errors returned by the underlying operating system.
@@ -944,6 +1012,12 @@ typedef enum _CMPIrc {
     CMPI_RC_ERR_INVALID_DATA_TYPE = 61,
     /** Characters are not representable in the specified codepage */
     CMPI_RC_ERR_NOT_IN_CODEPAGE = 62,
+#ifdef CMPI_VER_220
+    /** The MB does not need any further results for the request (e.g. the
+        client has cancelled it); added in CMPI 2.2 and returned only to MIs
+        with an miVersion of 220 or higher (see CMPIResult) */
+    CMPI_RC_ERR_ABORTED = 63,
+#endif /*CMPI_VER_220*/
 
     /*
      * Return codes for errors returned by the underlying operating system
@@ -986,6 +1060,42 @@ typedef struct _CMPIStatus {
 
 } CMPIStatus;
 
+#ifdef CMPI_VER_220
+
+/**
+ * @}
+ * @addtogroup broker-async
+ * @{
+ */
+
+/**
+ * @brief A function pointer type for a completion function of an
+ *     asynchronous up-call.
+ *
+ * Such a function pointer is passed to the functions of
+ * @ref CMPIBrokerAsyncFT. The MB calls the completion function exactly once
+ * for each asynchronous up-call that it has accepted, when the up-call has
+ * completed.
+ *
+ * @param rc The return status of the up-call, with the same return codes as
+ *     the corresponding function of @ref CMPIBrokerFT.
+ * @param result The result of the up-call. If @p rc indicates success, it
+ *     has the same value and type as the return value of the corresponding
+ *     function of @ref CMPIBrokerFT (e.g. @ref CMPI_instance for
+ *     CMPIBrokerAsyncFT.getInstanceAsync(), or @ref CMPI_enumeration for
+ *     CMPIBrokerAsyncFT.enumerateInstancesAsync()). Otherwise, its state is
+ *     @ref CMPI_nullValue.
+ * @param parm A pointer to arbitrary data, which was passed to the function
+ *     of @ref CMPIBrokerAsyncFT that initiated the up-call.
+ * @return None.
+ *
+ * @added220
+ */
+typedef void (*CMPICompletionFunc)(CMPIStatus rc, CMPIData result,
+    void* parm);
+
+#endif /*CMPI_VER_220*/
+
 /**
  * @}
  * @addtogroup mb-capabilities
@@ -1022,6 +1132,9 @@ typedef struct _CMPIStatus {
  * @li @ref cap-tracing "Tracing"
  * @li @ref cap-filtering "Property Filtering"
  * @li @ref cap-codepage "Codepage Conversion"
+ * @li @ref cap-batchresults "Batched Results"
+ * @li @ref cap-memarena "Memory Arena"
+ * @li @ref cap-async "Asynchronous Client Services"
  * @li @ref cap-translation "Message Translation" (no capability bit)
  * @li @ref cap-context "Context Data" (no capability bit)
  */
@@ -1128,6 +1241,34 @@ typedef struct _CMPIStatus {
 #define CMPI_MB_CodepageConversion          0x00080000
 #endif /* CMPI_VER_210 */
 
+#ifdef CMPI_VER_220
+/**
+ * @brief Test mask for @ref cap-batchresults "Batched Results" capability.
+ *
+ * @added220
+ */
+#define CMPI_MB_BatchedResults              0x00100000
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/**
+ * @brief Test mask for @ref cap-memarena "Memory Arena" capability.
+ *
+ * @added220
+ */
+#define CMPI_MB_MemArena                    0x00204000
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/**
+ * @brief Test mask for @ref cap-async "Asynchronous Client Services"
+ *     capability.
+ *
+ * @added220
+ */
+#define CMPI_MB_AsyncClientServices         0x00400001
+#endif /* CMPI_VER_220 */
+
 // Deprecated: The following symbols are synonyms for other symbols and are
 // defined only for backwards compatibility. They are not part of the CMPI
 // Standard, and their use is deprecated.
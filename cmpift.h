@@ -248,6 +248,19 @@ typedef struct _CMPIBroker {
 
 #endif /*CMPI_VER_200*/
 
+#ifdef CMPI_VER_220
+
+    /**
+     * @brief Pointer to the function table for MB asynchronous client
+     *     services.
+     *
+     * @capasync If that capability is not available, this pointer is NULL.
+     * @added220
+     */
+    const CMPIBrokerAsyncFT* aft;
+
+#endif /*CMPI_VER_220*/
+
 } CMPIBroker;
 
 /**
@@ -1835,6 +1848,75 @@ typedef struct _CMPIBrokerFT {
         const char** properties, const char* filterQueryLanguage,
         const char* filterQuery, CMPIStatus* rc);
 
+#ifdef CMPI_VER_220
+
+    /**
+     *   @}
+     *   @addtogroup broker-thread-reg
+     *   @{
+     */
+
+    /**
+     @brief Rebind the current thread to the per-request data of another
+         context.
+
+     CMPIBrokerFT.rebindThread() updates the context of the current thread,
+     which is attached to the MB, with the per-request data of a context
+     that was used to invoke an MI function.
+
+     This allows a long-lived worker thread of an MI to be prepared and
+     attached to the MB once, and to then serve many requests: Instead of
+     calling CMPIBrokerFT.prepareAttachThread(),
+     CMPIBrokerFT.attachThread() and CMPIBrokerFT.detachThread() for each
+     request, which causes the MB to copy the complete context and register
+     the thread each time, the worker thread calls this function at the
+     begin of each request.
+
+     The following context entries of @p ctx are replaced by the
+     corresponding entries of @p reqCtx, or removed if @p reqCtx does not
+     have them:
+     @li @ref CMPIPrincipal
+     @li @ref CMPIRole
+     @li @ref CMPIInvocationFlags
+     @li @ref CMPIAcceptLanguage
+     @li @ref CMPIContentLanguage
+
+     In addition, MBs that carry an internal security context in the opaque
+     part of CMPIContext objects set up the security context of the current
+     thread from @p reqCtx. All other context entries of @p ctx are
+     unchanged.
+
+     @param mb Points to a CMPIBroker structure.
+     @param ctx Points to the CMPIContext object with which the current
+         thread has been attached using CMPIBrokerFT.attachThread(). That
+         object shall have been returned by CMPIBrokerFT.prepareAttachThread()
+         and is updated by this function.
+     @param reqCtx Points to the CMPIContext object that was used to invoke the
+         MI function on whose behalf the current thread will work next. The
+         MB uses this object only during this call. Like any CMPIContext
+         object passed to an MI function, it is only valid until that MI
+         function returns; therefore, the MI function shall not return
+         before the current thread has called this function and has finished
+         working on its behalf.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb, @p ctx or @p reqCtx handle
+         is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - The current thread is not attached
+         to the MB with @p ctx.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CBRebindThread()
+     @added220
+    */
+    CMPIStatus (*rebindThread) (const CMPIBroker* mb, const CMPIContext* ctx,
+        const CMPIContext* reqCtx);
+
+#endif /*CMPI_VER_220*/
+
     /**
      *   @}
      */
@@ -2791,6 +2873,12 @@ typedef struct _CMPIBrokerEncFT {
      CMPIBrokerEncFT.newPropertyList() creates a new CMPIPropertyList that is
      initialized to a list of property names.
 
+     Since CMPI 2.2, the MB should prepare the new object for fast lookups
+     at creation time (e.g. by building a hash set of the case-folded
+     property names), so that CMPIPropertyListFT.isPropertyInList() does not
+     need to scan the list or fold the lexical case of the list entries on
+     each call.
+
      @param mb Points to a CMPIBroker structure.
      @param properties Points to the first entry of a NULL-terminated array of
          pointers to C strings that specify the property names in the property
@@ -2815,6 +2903,8 @@ typedef struct _CMPIBrokerEncFT {
      @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
      @convfunction CMNewPropertyList()
      @added210
+     @changed220 In CMPI 2.2, recommended that the MB prepares the new object
+         for fast lookups.
     */
     CMPIPropertyList* (*newPropertyList) (const CMPIBroker* mb,
         const char** properties, CMPIStatus* rc);
@@ -2865,6 +2955,18 @@ typedef struct _CMPIBrokerEncFT {
      CMPIBrokerEncFT.newEnumerationFilter() creates a new CMPIEnumerationFilter
      object that is initialized with a filter query.
 
+     Since CMPI 2.2, the MB should translate the filter query into an internal
+     form that is suitable for repeated evaluation (e.g. a compiled query
+     plan) when creating the new object, rather than interpreting the filter
+     query on each call to CMPIEnumerationFilterFT.match(). Because clients
+     typically issue the same filter queries repeatedly, the MB may keep such
+     internal forms in a cache keyed by @p filterQueryLanguage and
+     @p filterQuery (e.g. with least-recently-used replacement), and may share
+     a cached internal form between multiple CMPIEnumerationFilter objects.
+     The MI cannot distinguish these cases: CMPIEnumerationFilter objects
+     cannot be modified through any function, so sharing does not affect
+     their behavior.
+
      @param mb Points to a CMPIBroker structure.
      @param filterQueryLanguage Query language used for @p filterQuery. If this
          argument is NULL, the new CMPIEnumerationFilter object will be set to
@@ -2898,6 +3000,9 @@ typedef struct _CMPIBrokerEncFT {
          language is not supported.
      @convfunction CMNewEnumerationFilter()
      @added210
+     @changed220 In CMPI 2.2, recommended that the MB translates the filter
+         query once, and allowed the MB to share translated filter queries
+         between CMPIEnumerationFilter objects.
     */
     CMPIEnumerationFilter* (*newEnumerationFilter) (const CMPIBroker* mb,
             const char* filterQueryLanguage, const char* filterQuery,
@@ -2905,187 +3010,813 @@ typedef struct _CMPIBrokerEncFT {
 
 #endif /*CMPI_VER_210*/
 
-    /**
-     *   @}
-     */
-
-} CMPIBrokerEncFT;
-
-struct timespec;
-
-/**
- * @brief Function table for MB operating system encapsulation services.
- *
- * This function table is referenced by the CMPIBroker structure, and provides
- * the following operating system encapsulation services:
- * @ref brokerext-lib "Library Resolution",
- * @ref brokerext-thread "POSIX-conformant Threads",
- * @ref brokerext-mutex "POSIX-conformant Mutexes", and
- * @ref brokerext-condition "POSIX-conformant Conditions".
- *
- * @capopsys
- * @required200
- *
- * If the OS Encapsulation Services capability is not supported, the
- * function pointers in this function table shall not be NULL, but shall point
- * to a function that can be called and then indicate back to the caller that
- * it is not supported, as specified in the description of the function.
- */
-typedef struct _CMPIBrokerExtFT {
+#ifdef CMPI_VER_220
 
     /**
-     * @brief CMPI version supported by the MB for this function table.
-     *
-     * Any earlier CMPI versions are implicitly also supported.
-     *
-     * See @ref sym-version-nnn "CMPIVersion\<NNN\>" for valid CMPI
-     * version numbers.
-     */
-    CMPIVersion ftVersion;
+     @brief Create a new CMPIInstance object from an instance template.
 
-    /**
-     *   @addtogroup brokerext-lib
-     *   @{
-     */
+     CMPIBrokerEncFT.newInstanceFromTemplate() creates a new CMPIInstance
+     object that is a copy of a template instance, with a new object path.
 
-    /**
-     @brief Resolve a generic load library name to its file name.
+     The template instance is a CMPIInstance object that has been prepared by
+     the MI (e.g. using CMPIBrokerEncFT.newInstance() and setting the
+     properties whose values are common to all instances), and that is kept
+     by the MI for repeated use. Because the class of the template instance
+     has already been resolved, the MB does not need to look up the class
+     for each new instance, and may share the internal property table of the
+     template instance until the new instance is modified.
 
-     CMPIBrokerExtFT.resolveFileName() resolves a generic load library name to
-     its file name.
+     The new CMPIInstance object has the same class, properties, property
+     values and property filter (see CMPIInstanceFT.setPropertyFilter()) as
+     the template instance. Subsequent changes to the new CMPIInstance object
+     do not affect the template instance, and vice versa.
 
-     @param libName A generic load library name. Depending on the underlying OS,
-         load library names have specific formats: For the generic load library
-         name "MyLibrary", the corresponding file name on Linux is
-         "libMyLibrary.so". The corresponding file name on Windows is
-         "MyLibrary.dll".
+     The template instance may be used concurrently by multiple threads
+     calling this function, as long as it is not modified at the same time.
+
+     @param mb Points to a CMPIBroker structure.
+     @param tmpl Points to the CMPIInstance object that is used as a template.
+         That object shall have been created using CMPIInstanceFT.clone(), so
+         that it remains valid across MI function invocations.
+     @param instPath Points to a CMPIObjectPath object. The object path of the
+         new CMPIInstance object will be set to the object path in @p instPath.
+         The object path in @p instPath shall specify the same namespace and
+         creation class name as the object path of @p tmpl. It shall specify
+         no or all keys for the instance, and may specify a non-NULL host name.
+         If @p instPath is NULL, the object path of the new CMPIInstance object
+         will be set to a copy of the object path of @p tmpl.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
      @return @parblock
-         If successful, a pointer to a new C-language string containing the
-         file name of the load library (without path) will be returned.
+         If successful, a pointer to the new CMPIInstance object will be
+         returned.
 
-         The character array of the returned string shall not be explicitly
-         released by the MI, because it will be automatically released by the
-         MB (see Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard").
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard". If
+         the new object is no longer used by the MI, it may be explicitly
+         released by the MI using CMPIBrokerMemFT.freeInstance().
 
          If not successful, NULL will be returned.
      @endparblock
-     @convfunction None.
-     @required200
-
-     @todo TODO_KS The old text in the description of the return value
-         said:@n
-         "Space for this string has been obtained using POSIX ``malloc()`` and
-         must be released using POSIX ``free()`` by the caller.
-         In case no storage could be obtained for the complemented library
-         name, returns NULL."@n
-         The spec says we changed that to auto-release by MB.@n
-         Karl to double check the implementation
-    */
-    char* (*resolveFileName) (const char* libName);
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb, @p tmpl or @p instPath
+         handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - The namespace or creation class
+         name specified in @p instPath differs from those of @p tmpl.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMNewInstanceFromTemplate()
+     @added220
+    */
+    CMPIInstance* (*newInstanceFromTemplate) (const CMPIBroker* mb,
+        const CMPIInstance* tmpl, const CMPIObjectPath* instPath,
+        CMPIStatus* rc);
 
     /**
-     *   @}
-     *   @addtogroup brokerext-thread
-     *   @{
-     */
+     @brief Create a new CMPIString object that takes ownership of a
+         C-language string.
 
-    /**
-     @brief Start a new thread, using POSIX threading semantics.
+     CMPIBrokerEncFT.newStringAdopt() creates a new CMPIString object that
+     takes ownership of a C-language string allocated by the MB, without
+     copying it.
 
-     CMPIBrokerExtFT.newThread() starts a new thread, using POSIX threading
-     semantics.
+     If the function is successful, the MB owns the memory of @p data, and
+     frees it when the new CMPIString object is released (using
+     CMPIStringFT.release(), CMPIBrokerMemFT.freeString(), or automatically
+     by the MB). The MI shall no longer access @p data after the new
+     CMPIString object has been released, and shall not free @p data itself.
 
-     Creating a thread using CMPIBrokerExtFT.newThread() does not inform
-     the MB that the new thread will begin using MB functions. Thus,
-     @ref CMPIBrokerFT::attachThread "CMPIBrokerFT.attachThread()"
-     must be called by the new thread before it uses MB functions.
+     Because the MB owns the memory of @p data, it may share that memory
+     (instead of copying it) when the new CMPIString object is assigned to
+     another object, e.g. as a property value using
+     CMPIInstanceFT.setProperty() with type @ref CMPI_string.
 
-     @param start Points to the function to be started as a thread.
-         For details, see type @ref CMPIThreadFunc.
-     @param parm Points to argument(s) to be passed to that function.
-     @param detached If not zero, defines that the new thread should run in
-         detached mode. In detached mode, termination of the thread that called
-         this function does not cause the new thread to be canceled. See
-         @ref ref-ieee-1003-1 "IEEE 1003.1" for details on detached mode.
+     If the function is not successful, the MI retains ownership of @p data.
+
+     @param mb Points to a CMPIBroker structure.
+     @param data C-language string in UTF-8 used as the content of the new
+         CMPIString object. It shall have been allocated using
+         CMPIBrokerMemFT.cmpiMalloc(), CMPIBrokerMemFT.cmpiCalloc(),
+         CMPIBrokerMemFT.cmpiRealloc() or CMPIBrokerMemFT.cmpiStrDup(), and
+         shall not be modified by the MI after this call.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
      @return @parblock
-         If successful, the handle of the started thread will be returned.
+         If successful, the newly created CMPIString will be returned.
+
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard". If
+         the new object is no longer used by the MI, it may be explicitly
+         released by the MI using CMPIBrokerMemFT.freeString().
 
          If not successful, NULL will be returned.
      @endparblock
      @errors
-     For historical reasons, no additional error information is passed back.
-     @convfunction None.
-     @capopsys
-     @required200
-
-     @todo TODO_KS Karl to test the new function types in actual code,
-           particularly with MSVC compiler:
-           @ref CMPIThreadFunc,
-           @ref CMPIThreadOnceFunc,
-           @ref CMPIThreadKeyCleanupFunc.
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p data is NULL or has not been
+         allocated by the MB.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMNewStringAdopt()
+     @capmemory
+     @added220
     */
-    CMPI_THREAD_TYPE (*newThread) (CMPIThreadFunc start, void* parm,
-        int detached);
+    CMPIString* (*newStringAdopt) (const CMPIBroker* mb, char* data,
+        CMPIStatus* rc);
 
     /**
-     @brief Wait until the specified thread ends, using POSIX threading
-         semantics.
+     @brief Create a new CMPIString object that references a C-language
+         string.
 
-     CMPIBrokerExtFT.joinThread() suspends the current thread to wait until the
-     specified thread ends, using POSIX threading semantics.
+     CMPIBrokerEncFT.newStringView() creates a new CMPIString object that
+     references a C-language string owned by the MI, without copying it.
 
-     @param thread Handle of the thread to wait for.
-     @param retval Points to the return value of the thread. On successful
-         completion, the return value of the thread will be stored in this
-         location.
+     The MI shall ensure that @p data remains valid and unchanged until the
+     new CMPIString object has been released (using CMPIStringFT.release(),
+     CMPIBrokerMemFT.freeString(), or automatically by the MB at the end of
+     the MI function invocation or object lifecycle level in which it was
+     created). The MB never frees @p data.
+
+     Functions that create independent copies of the new CMPIString object
+     (such as CMPIStringFT.clone()), or that assign it to another object (such
+     as CMPIInstanceFT.setProperty() with type @ref CMPI_string), copy the
+     string content, so that the result does not depend on the lifetime of
+     @p data.
+
+     @param mb Points to a CMPIBroker structure.
+     @param data C-language string in UTF-8 that is referenced by the new
+         CMPIString object.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
      @return @parblock
-         If successful, zero will be returned.
+         If successful, the newly created CMPIString will be returned.
 
-         If not successful, a non-zero error code will be returned.
+         CMPIStringFT.getCharPtr() on the new object returns @p data.
+
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard". If
+         the new object is no longer used by the MI, it may be explicitly
+         released by the MI using CMPIBrokerMemFT.freeString().
+
+         If not successful, NULL will be returned.
      @endparblock
      @errors
-     Error codes are defined in `errno.h`, specifically for the
-     ``pthread_join()`` function; both are defined in
-     @ref ref-ieee-1003-1 "IEEE 1003.1".
-     @convfunction None.
-     @capopsys
-     @required200
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p data is NULL.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMNewStringView()
+     @added220
     */
-    int (*joinThread) (CMPI_THREAD_TYPE thread, CMPI_THREAD_RETURN* retval);
+    CMPIString* (*newStringView) (const CMPIBroker* mb, const char* data,
+        CMPIStatus* rc);
 
     /**
-     @brief Cause current thread to exit with the passed-in return code, using
-         POSIX threading semantics.
+     *   @}
+     *   @addtogroup brokerenc-misc
+     *   @{
+     */
 
-     CMPIBrokerExtFT.exitThread() causes the current thread to exit with the
-     passed-in return code, using POSIX threading semantics.
+    /**
+     @brief Resolve a property name of a class to a property handle.
 
-     The current thread can also exit by simply returning from its thread
-     function; the purpose of the CMPIBrokerExtFT.exitThread() function is to
-     make premature returns more convenient.
+     CMPIBrokerEncFT.getPropertyHandle() resolves a property name of a class
+     to a @ref CMPIPropertyHandle, for use with
+     CMPIInstanceFT.getPropertyByHandle() and
+     CMPIInstanceFT.setPropertyByHandle().
 
-     @param return_code The return code that should be used for the thread.
-     @return The function never returns, regardless of whether it is
-         successful or encounters errors.
+     Resolving the property name once (e.g. during the initialization of the
+     MI) allows the MB to access the property in instances of the class
+     without looking up its name on each access.
+
+     A property handle can be used with any CMPIInstance object. For
+     instances of the class specified in @p classPath, the MB can access the
+     property without a name lookup. For instances of other classes, the
+     access is equivalent to an access by property name.
+
+     @param mb Points to a CMPIBroker structure.
+     @param classPath Points to a CMPIObjectPath object that references the
+         class and namespace for which the property name is resolved. Any key
+         bindings in that object path are ignored.
+     @param name Property name. The name is matched case-insensitively.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, the property handle will be returned.
+
+         The property handle remains valid until the MI is cleaned up. There
+         is no function to explicitly release the property handle.
+
+         If not successful, NULL will be returned.
+     @endparblock
      @errors
-     None; the function never returns.
-     @convfunction None.
-     @capopsys
-     @required200
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb or @p classPath handle is
+         invalid.
+     @li `CMPI_RC_ERR_INVALID_NAMESPACE` - The namespace specified in
+         @p classPath does not exist.
+     @li `CMPI_RC_ERR_INVALID_CLASS` - The class specified in @p classPath
+         does not exist.
+     @li `CMPI_RC_ERR_NO_SUCH_PROPERTY` - The class specified in @p classPath
+         does not expose a property named @p name.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMGetPropertyHandle()
+     @added220
     */
-    int (*exitThread) (CMPI_THREAD_RETURN return_code);
+    CMPIPropertyHandle (*getPropertyHandle) (const CMPIBroker* mb,
+        const CMPIObjectPath* classPath, const char* name, CMPIStatus* rc);
 
     /**
-     @brief Cancel a running thread, using POSIX threading semantics.
+     *   @}
+     *   @addtogroup brokerenc-factory
+     *   @{
+     */
 
-     CMPIBrokerExtFT.cancelThread() cancels the thread identified by @p thread,
-     using POSIX threading semantics.
+    /**
+     @brief Create a new, empty CMPIFilterSet object.
 
-     @param thread Handle of the thread to be canceled.
+     CMPIBrokerEncFT.newFilterSet() creates a new CMPIFilterSet object that
+     does not contain any filters. Filters are added to it using
+     CMPIFilterSetFT.addFilter().
+
+     @param mb Points to a CMPIBroker structure.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
      @return @parblock
-         If successful, zero will be returned.
+         If successful, a pointer to the new CMPIFilterSet object will be
+         returned.
 
-         If not successful, a non-zero error code will be returned.
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard".
+         Because a filter set is typically kept across MI function invocations
+         (e.g. from CMPIIndicationMIFT.activateFilter() to
+         CMPIIndicationMIFT.deActivateFilter()), the MI will usually detach it
+         from that automatic release using CMPIFilterSetFT.clone() and release
+         the clone using CMPIFilterSetFT.release().
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMNewFilterSet()
+     @capquerynorm
+     @added220
+    */
+    CMPIFilterSet* (*newFilterSet) (const CMPIBroker* mb, CMPIStatus* rc);
+
+    /**
+     *   @}
+     *   @addtogroup brokerenc-misc
+     *   @{
+     */
+
+    /**
+     @brief Serialize a CMPI encapsulated data type object into a binary
+         representation.
+
+     CMPIBrokerEncFT.serialize() serializes a CMPIInstance, CMPIObjectPath,
+     CMPIArgs or CMPIArray object into a binary representation that can be
+     stored by the MI (e.g. in a cache file) and converted back into an
+     equivalent object using CMPIBrokerEncFT.deserialize().
+
+     The binary representation is MB implementation-specific. It includes an
+     identification of its format and format version, so that
+     CMPIBrokerEncFT.deserialize() can reject binary representations it does
+     not support. It does not contain any pointers and may be stored at any
+     address, so that it can be used directly from memory-mapped files.
+
+     The binary representation contains the complete content of the object,
+     including values of all @ref CMPIType types except @ref CMPI_ptr, the
+     state of each value, and nested objects such as embedded instances and
+     references.
+
+     If @p buf is NULL or @p bufSize is less than the size of the binary
+     representation, nothing is stored, and the required size is returned.
+     This allows the MI to determine the size before allocating the buffer.
+
+     @param mb Points to a CMPIBroker structure.
+     @param value Points to a CMPIValue structure containing the object to be
+         serialized, in the member that corresponds to @p type.
+     @param type Type of the object in @p value. Shall be @ref CMPI_instance,
+         @ref CMPI_ref, @ref CMPI_args, or an array type.
+     @param [out] buf If not NULL, points to a buffer that upon success will
+         have been updated with the binary representation.
+     @param bufSize Size of @p buf in Bytes.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, the size of the binary representation in Bytes will
+         be returned. If that size is greater than @p bufSize, nothing has
+         been stored in @p buf.
+
+         If not successful, 0 will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle or the object handle
+         in @p value is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p value is NULL.
+     @li `CMPI_RC_ERR_INVALID_DATA_TYPE` - @p type is not one of the types
+         listed above or is not recognized, or the object contains a value of
+         type @ref CMPI_ptr.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMSerialize()
+     @added220
+    */
+    size_t (*serialize) (const CMPIBroker* mb, const CMPIValue* value,
+        CMPIType type, void* buf, size_t bufSize, CMPIStatus* rc);
+
+    /**
+     @brief Create a new CMPI encapsulated data type object from its binary
+         representation.
+
+     CMPIBrokerEncFT.deserialize() creates a new CMPIInstance,
+     CMPIObjectPath, CMPIArgs or CMPIArray object from a binary representation
+     that was created using CMPIBrokerEncFT.serialize().
+
+     @param mb Points to a CMPIBroker structure.
+     @param buf Points to the binary representation. The MB uses it only
+         during this call.
+     @param size Size of the binary representation in Bytes.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a CMPIData structure will be returned, whose type is
+         the type that was passed to CMPIBrokerEncFT.serialize() (that is,
+         @ref CMPI_instance, @ref CMPI_ref, @ref CMPI_args, or an array type),
+         and whose value is the new object.
+
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard". If
+         the new object is no longer used by the MI, it may be explicitly
+         released by the MI using the release() function of its function
+         table.
+
+         If not successful, CMPIData.state will be undefined.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p buf does not contain a binary
+         representation in a format or format version supported by this MB,
+         or it is truncated.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMDeserialize()
+     @added220
+    */
+    CMPIData (*deserialize) (const CMPIBroker* mb, const void* buf,
+        size_t size, CMPIStatus* rc);
+
+    /**
+     @brief Write a set of instances into a persistent snapshot.
+
+     CMPIBrokerEncFT.writeSnapshot() writes a set of instances into a
+     persistent snapshot, replacing any existing snapshot with the same name.
+     The snapshot survives a restart of the MB, and can be read back using
+     CMPIBrokerEncFT.readSnapshot().
+
+     This allows MIs whose instances are expensive to determine (e.g. by
+     probing devices) to save them, typically in CMPIInstanceMIFT.cleanup(),
+     and to serve requests from the snapshot after the next start of the MI
+     while they determine the current instances in the background.
+
+     The MB stores snapshots in an MB implementation-specific location, using
+     the binary representation defined for CMPIBrokerEncFT.serialize(), in a
+     form that allows them to be memory-mapped when read back. Writing a
+     snapshot is atomic: If this function fails, or the MB terminates during
+     this function, any existing snapshot with the same name is unchanged.
+
+     @param mb Points to a CMPIBroker structure.
+     @param name Name of the snapshot. Snapshot names are shared by all MIs
+         of the MB, so MIs should start them with their MI name.
+     @param insts Points to an array of @p n pointers to CMPIInstance objects
+         that are written into the snapshot. The MB uses them only during
+         this call.
+     @param n Number of entries in the @p insts array.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle or one of the
+         instances in @p insts is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p name is NULL or not a valid
+         snapshot name for this MB.
+     @li `CMPI_RC_ERR_INVALID_DATA_TYPE` - One of the instances contains a
+         value of type @ref CMPI_ptr.
+     @li `CMPI_RC_ERR_FAILED` - The snapshot could not be written.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMWriteSnapshot()
+     @added220
+    */
+    CMPIStatus (*writeSnapshot) (const CMPIBroker* mb, const char* name,
+        const CMPIInstance* const* insts, CMPICount n);
+
+    /**
+     @brief Read the instances of a persistent snapshot.
+
+     CMPIBrokerEncFT.readSnapshot() reads the instances of a persistent
+     snapshot that was written using CMPIBrokerEncFT.writeSnapshot().
+
+     The MB should memory-map the snapshot, and create each CMPIInstance
+     object only when it is retrieved from the returned CMPIEnumeration
+     object, so that the cost of this function does not depend on the number
+     of instances in the snapshot.
+
+     The returned CMPIEnumeration object and any copies of it created using
+     CMPIEnumerationFT.clone() are called snapshot enumerations. For snapshot
+     enumerations, CMPIEnumerationFT.clone() shall share the snapshot with the
+     original object instead of copying its instances, and shall not create
+     any CMPIInstance objects; the copy is positioned at the same element as
+     the original, and is iterated independently of it. Thus, the cost of
+     cloning a snapshot enumeration does not depend on the number of
+     instances in the snapshot, and the cost of serving a request from the
+     snapshot depends only on the instances retrieved for that request.
+
+     Because a CMPIEnumeration object can be iterated only once, an MI that
+     serves multiple requests from a snapshot keeps a clone of the returned
+     object that it does not iterate, and clones that object once per request
+     to obtain a snapshot enumeration for that request (see the example of
+     CMWriteSnapshot()). The snapshot remains memory-mapped until all
+     snapshot enumerations for it have been released.
+
+     @param mb Points to a CMPIBroker structure.
+     @param name Name of the snapshot.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to a new CMPIEnumeration object will be
+         returned, containing CMPIInstance objects for the instances in the
+         snapshot, in the order in which they were written.
+
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard".
+         There is no function to explicitly release the new object. The MI can
+         keep it beyond the current MI function by creating a clone using
+         CMPIEnumerationFT.clone(), as described above.
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p name is NULL or not a valid
+         snapshot name for this MB.
+     @li `CMPI_RC_ERR_NOT_FOUND` - No snapshot with that name exists, or the
+         snapshot has been written in a format that is not supported by this
+         MB (e.g. by an earlier version of the MB). The MI needs to determine
+         its instances in the usual way in this case.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMReadSnapshot()
+     @added220
+    */
+    CMPIEnumeration* (*readSnapshot) (const CMPIBroker* mb, const char* name,
+        CMPIStatus* rc);
+
+    /**
+     @brief Remove a persistent snapshot.
+
+     CMPIBrokerEncFT.removeSnapshot() removes a persistent snapshot that was
+     written using CMPIBrokerEncFT.writeSnapshot(). CMPIEnumeration objects
+     returned by CMPIBrokerEncFT.readSnapshot() for the snapshot remain
+     usable until they are released.
+
+     @param mb Points to a CMPIBroker structure.
+     @param name Name of the snapshot.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p name is NULL or not a valid
+         snapshot name for this MB.
+     @li `CMPI_RC_ERR_NOT_FOUND` - No snapshot with that name exists.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMRemoveSnapshot()
+     @added220
+    */
+    CMPIStatus (*removeSnapshot) (const CMPIBroker* mb, const char* name);
+
+    /**
+     *   @}
+     *   @addtogroup brokerenc-factory
+     *   @{
+     */
+
+    /**
+     @brief Create a new CMPIObjectPath object from the canonical binary
+         representation of an object path.
+
+     CMPIBrokerEncFT.newObjectPathFromBinary() creates a new CMPIObjectPath
+     object from the canonical binary representation of an object path that
+     was created using CMPIObjectPathFT.toBinary().
+
+     The new object path has no host name, and its namespace, class name and
+     key binding names are in the case-normalized form used by the binary
+     representation.
+
+     @param mb Points to a CMPIBroker structure.
+     @param buf Points to the binary representation. The MB uses it only
+         during this call.
+     @param size Size of the binary representation in Bytes.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to the new CMPIObjectPath object will be
+         returned.
+
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard". If
+         the new object is no longer used by the MI, it may be explicitly
+         released by the MI using CMPIBrokerMemFT.freeObjectPath().
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p buf does not contain a binary
+         representation of an object path that is supported by this MB, or
+         it is truncated.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMNewObjectPathFromBinary()
+     @added220
+    */
+    CMPIObjectPath* (*newObjectPathFromBinary) (const CMPIBroker* mb,
+        const void* buf, size_t size, CMPIStatus* rc);
+
+    /**
+     @brief Create a new CMPIObjectPath object initialized to a given
+         namespace, class name and key bindings.
+
+     CMPIBrokerEncFT.newObjectPathWithKeys() creates a new CMPIObjectPath
+     object that is initialized to a given namespace, class name and key
+     bindings. The result is the same as calling
+     CMPIBrokerEncFT.newObjectPath() followed by CMPIObjectPathFT.addKeys(),
+     but requires only one call.
+
+     @param mb Points to a CMPIBroker structure.
+     @param ns Namespace name.
+     @param cn Class name.
+     @param names Points to an array of @p n key binding names.
+     @param values Points to an array of @p n CMPIValue structures containing
+         the values to be assigned to the key bindings. Key bindings are not
+         permitted to be NULL.
+     @param types Points to an array of @p n types of the values to be
+         assigned to the key bindings, with the same requirements as for
+         CMPIObjectPathFT.addKey(). C-language strings referenced by values of
+         type @ref CMPI_chars are copied by this function.
+     @param n Number of key bindings, i.e. number of entries in the
+         @p names, @p values and @p types arrays.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to the new CMPIObjectPath object will be
+         returned.
+
+         The new object will be automatically released by the MB, as described
+         in Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard". If
+         the new object is no longer used by the MI, it may be explicitly
+         released by the MI using CMPIBrokerMemFT.freeObjectPath().
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_NAMESPACE` - The namespace specified in
+         @p ns is invalid or does not exist.
+     @li `CMPI_RC_ERR_NOT_FOUND` - The class specified in @p cn is invalid or
+         does not exist.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - One of the key binding names or
+         values is invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMNewObjectPathWithKeys()
+     @added220
+    */
+    CMPIObjectPath* (*newObjectPathWithKeys) (const CMPIBroker* mb,
+        const char* ns, const char* cn, const char** names,
+        const CMPIValue* values, const CMPIType* types, CMPICount n,
+        CMPIStatus* rc);
+
+#endif /*CMPI_VER_220*/
+
+    /**
+     *   @}
+     */
+
+} CMPIBrokerEncFT;
+
+struct timespec;
+
+/**
+ * @brief Function table for MB operating system encapsulation services.
+ *
+ * This function table is referenced by the CMPIBroker structure, and provides
+ * the following operating system encapsulation services:
+ * @ref brokerext-lib "Library Resolution",
+ * @ref brokerext-thread "POSIX-conformant Threads",
+ * @ref brokerext-mutex "POSIX-conformant Mutexes", and
+ * @ref brokerext-condition "POSIX-conformant Conditions".
+ *
+ * @capopsys
+ * @required200
+ *
+ * If the OS Encapsulation Services capability is not supported, the
+ * function pointers in this function table shall not be NULL, but shall point
+ * to a function that can be called and then indicate back to the caller that
+ * it is not supported, as specified in the description of the function.
+ */
+typedef struct _CMPIBrokerExtFT {
+
+    /**
+     * @brief CMPI version supported by the MB for this function table.
+     *
+     * Any earlier CMPI versions are implicitly also supported.
+     *
+     * See @ref sym-version-nnn "CMPIVersion\<NNN\>" for valid CMPI
+     * version numbers.
+     */
+    CMPIVersion ftVersion;
+
+    /**
+     *   @addtogroup brokerext-lib
+     *   @{
+     */
+
+    /**
+     @brief Resolve a generic load library name to its file name.
+
+     CMPIBrokerExtFT.resolveFileName() resolves a generic load library name to
+     its file name.
+
+     @param libName A generic load library name. Depending on the underlying OS,
+         load library names have specific formats: For the generic load library
+         name "MyLibrary", the corresponding file name on Linux is
+         "libMyLibrary.so". The corresponding file name on Windows is
+         "MyLibrary.dll".
+     @return @parblock
+         If successful, a pointer to a new C-language string containing the
+         file name of the load library (without path) will be returned.
+
+         The character array of the returned string shall not be explicitly
+         released by the MI, because it will be automatically released by the
+         MB (see Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard").
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @convfunction None.
+     @required200
+
+     @todo TODO_KS The old text in the description of the return value
+         said:@n
+         "Space for this string has been obtained using POSIX ``malloc()`` and
+         must be released using POSIX ``free()`` by the caller.
+         In case no storage could be obtained for the complemented library
+         name, returns NULL."@n
+         The spec says we changed that to auto-release by MB.@n
+         Karl to double check the implementation
+    */
+    char* (*resolveFileName) (const char* libName);
+
+    /**
+     *   @}
+     *   @addtogroup brokerext-thread
+     *   @{
+     */
+
+    /**
+     @brief Start a new thread, using POSIX threading semantics.
+
+     CMPIBrokerExtFT.newThread() starts a new thread, using POSIX threading
+     semantics.
+
+     Creating a thread using CMPIBrokerExtFT.newThread() does not inform
+     the MB that the new thread will begin using MB functions. Thus,
+     @ref CMPIBrokerFT::attachThread "CMPIBrokerFT.attachThread()"
+     must be called by the new thread before it uses MB functions.
+
+     @param start Points to the function to be started as a thread.
+         For details, see type @ref CMPIThreadFunc.
+     @param parm Points to argument(s) to be passed to that function.
+     @param detached If not zero, defines that the new thread should run in
+         detached mode. In detached mode, termination of the thread that called
+         this function does not cause the new thread to be canceled. See
+         @ref ref-ieee-1003-1 "IEEE 1003.1" for details on detached mode.
+     @return @parblock
+         If successful, the handle of the started thread will be returned.
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     For historical reasons, no additional error information is passed back.
+     @convfunction None.
+     @capopsys
+     @required200
+
+     @todo TODO_KS Karl to test the new function types in actual code,
+           particularly with MSVC compiler:
+           @ref CMPIThreadFunc,
+           @ref CMPIThreadOnceFunc,
+           @ref CMPIThreadKeyCleanupFunc.
+    */
+    CMPI_THREAD_TYPE (*newThread) (CMPIThreadFunc start, void* parm,
+        int detached);
+
+    /**
+     @brief Wait until the specified thread ends, using POSIX threading
+         semantics.
+
+     CMPIBrokerExtFT.joinThread() suspends the current thread to wait until the
+     specified thread ends, using POSIX threading semantics.
+
+     @param thread Handle of the thread to wait for.
+     @param retval Points to the return value of the thread. On successful
+         completion, the return value of the thread will be stored in this
+         location.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_join()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @required200
+    */
+    int (*joinThread) (CMPI_THREAD_TYPE thread, CMPI_THREAD_RETURN* retval);
+
+    /**
+     @brief Cause current thread to exit with the passed-in return code, using
+         POSIX threading semantics.
+
+     CMPIBrokerExtFT.exitThread() causes the current thread to exit with the
+     passed-in return code, using POSIX threading semantics.
+
+     The current thread can also exit by simply returning from its thread
+     function; the purpose of the CMPIBrokerExtFT.exitThread() function is to
+     make premature returns more convenient.
+
+     @param return_code The return code that should be used for the thread.
+     @return The function never returns, regardless of whether it is
+         successful or encounters errors.
+     @errors
+     None; the function never returns.
+     @convfunction None.
+     @capopsys
+     @required200
+    */
+    int (*exitThread) (CMPI_THREAD_RETURN return_code);
+
+    /**
+     @brief Cancel a running thread, using POSIX threading semantics.
+
+     CMPIBrokerExtFT.cancelThread() cancels the thread identified by @p thread,
+     using POSIX threading semantics.
+
+     @param thread Handle of the thread to be canceled.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
      @endparblock
      @errors
      @parblock
@@ -3394,92 +4125,386 @@ typedef struct _CMPIBrokerExtFT {
     */
     CMPI_COND_TYPE (*newCondition) (int opt);
 
-    /**
-     @brief Destroy a POSIX threading-conformant condition variable.
-         (**Deprecated**)
+    /**
+     @brief Destroy a POSIX threading-conformant condition variable.
+         (**Deprecated**)
+
+     CMPIBrokerExtFT.destroyCondition() destroys a POSIX threading-conformant
+     condition variable.
+
+     @param cond Handle of the condition variable to be destroyed.
+     @return None.
+     @errors
+     For historical reasons, this function does not indicate whether it
+     succeeded or failed.
+     @convfunction None.
+     @capopsys
+     @required200
+     @deprecated This function is deprecated since CMPI 2.1,
+         because it does not indicate whether it succeeded or failed. Use
+         CMPIBrokerExtFT.destroyCondition2() instead.
+    */
+    void (*destroyCondition) (CMPI_COND_TYPE cond);
+
+    /**
+     @brief Wait until a POSIX threading-conformant condition variable is
+         signalled.
+
+     CMPIBrokerExtFT.condWait() waits until a POSIX threading-conformant
+     condition variable is signaled. If the condition variable has been
+     signaled already, the function returns immediately; otherwise, it
+     suspends the current thread to wait for the signal and then returns.
+
+     @param cond Handle of the condition variable to be used.
+     @param mutex Handle of a locked mutex guarding this condition
+         variable.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+    ``pthread_cond_wait()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @required200
+    */
+    int (*condWait) (CMPI_COND_TYPE cond, CMPI_MUTEX_TYPE mutex);
+
+    /**
+     @brief Wait until a POSIX threading-conformant condition variable is
+         signaled using a timeout value.
+
+     CMPIBrokerExtFT.timedCondWait() waits until a POSIX threading-conformant
+     condition variable is signalled. If the condition variable has been
+     signalled already, the function returns immediately; otherwise, it
+     suspends the current thread to wait for the signal and then returns. The
+     function returns when the timeout expires before the condition is
+     signalled.
+
+     @param cond Handle of the condition variable to be used.
+     @param mutex Handle of a locked mutex guarding this condition variable.
+     @param wait Timeout value. See structure ``timespec`` defined in `time.h`
+         for details; both are defined in @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_cond_timedwait()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @required200
+    */
+    int (*timedCondWait) (CMPI_COND_TYPE cond, CMPI_MUTEX_TYPE mutex,
+        struct timespec* wait);
+
+    /**
+     @brief Send a signal to a POSIX threading-conformant condition variable.
+
+     CMPIBrokerExtFT.signalCondition() sends a signal to a POSIX
+     threading-conformant condition variable.
+
+     @param cond Handle of the target condition variable.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_cond_signal()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @required200
+    */
+    int (*signalCondition) (CMPI_COND_TYPE cond);
+
+    /**
+     *   @}
+     *   @addtogroup brokerext-mutex
+     *   @{
+     */
+
+#ifdef CMPI_VER_210
+
+    /**
+     @brief Destroy a POSIX threading-conformant mutex.
+
+     CMPIBrokerExtFT.destroyMutex2() destroys a POSIX threading-conformant
+     mutex.
+
+     @param mutex Handle of the mutex to be destroyed.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_mutex_destroy()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @added210 Supersedes the deprecated CMPIBrokerExtFT.destroyMutex()
+         function.
+     @required210
+    */
+    int (*destroyMutex2) (CMPI_MUTEX_TYPE mutex);
+
+    /**
+     @brief Lock a POSIX threading-conformant mutex.
+
+     CMPIBrokerExtFT.lockMutex2() locks a POSIX threading conformant mutex.
+
+     If the mutex is locked by another thread, the current thread is suspended
+     until the lock is granted.
+
+     The behavior in case the mutex is already locked by the current thread
+     is defined in the description of CMPIBrokerExtFT.newMutex().
+
+     @param mutex Handle of the mutex to be locked.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_mutex_lock()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @added210 Supersedes the deprecated CMPIBrokerExtFT.lockMutex() function.
+     @required210
+    */
+    int (*lockMutex2) (CMPI_MUTEX_TYPE mutex);
+
+    /**
+     @brief Unlock a POSIX threading-conformant mutex.
+
+     CMPIBrokerExtFT.unlockMutex2() unlocks a POSIX threading conformant mutex.
+
+     The behavior in case the mutex is not locked by the current thread is
+     defined in the description of CMPIBrokerExtFT.newMutex().
+
+     @param mutex Handle of the mutex to be unlocked.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_mutex_lock()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @added210 Supersedes the deprecated CMPIBrokerExtFT.unlockMutex() function.
+     @required210
+    */
+    int (*unlockMutex2) (CMPI_MUTEX_TYPE mutex);
+
+    /**
+     *   @}
+     *   @addtogroup brokerext-condition
+     *   @{
+     */
+
+    /**
+     @brief Destroy a POSIX threading-conformant condition variable.
+
+     CMPIBrokerExtFT.destroyCondition2() destroys a POSIX threading-conformant
+     condition variable.
+
+     @param cond Handle of the condition variable to be destroyed.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, specifically for the
+     ``pthread_cond_destroy()`` function; both are defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     @convfunction None.
+     @capopsys
+     @added210 Supersedes the deprecated CMPIBrokerExtFT.destroyCondition()
+         function.
+     @required210
+    */
+    int (*destroyCondition2) (CMPI_COND_TYPE cond);
+
+#endif /*CMPI_VER_210*/
+
+#ifdef CMPI_VER_220
+
+    /**
+     *   @}
+     *   @addtogroup brokerext-pool
+     *   @{
+     */
+
+    /**
+     @brief Run a function as a task on a thread of the MB thread pool.
+
+     CMPIBrokerExtFT.submitTask() queues a function for execution on one of
+     the worker threads of a thread pool that is managed by the MB and shared
+     by all MIs. Using the thread pool instead of
+     CMPIBrokerExtFT.newThread() bounds the number of threads in the MB
+     process, and avoids the cost of creating a thread for each task.
+
+     The worker threads are attached to the MB: If @p ctx is not NULL, the
+     task runs as if the worker thread had called
+     @ref CMPIBrokerFT::attachThread "CMPIBrokerFT.attachThread()" with
+     @p ctx before the task, and
+     @ref CMPIBrokerFT::detachThread "CMPIBrokerFT.detachThread()" after the
+     task. Thus, the task can use MB functions, including up-calls, without
+     attaching the thread itself. The task shall not call
+     CMPIBrokerFT.attachThread() or CMPIBrokerFT.detachThread() for the
+     worker thread, nor CMPIBrokerExtFT.exitThread() or
+     CMPIBrokerExtFT.cancelThread().
+
+     @param ctx
+     @parblock
+         If not NULL, points to a CMPIContext object that was returned by
+         CMPIBrokerFT.prepareAttachThread() and that is used for running the
+         task. If NULL, the task shall not use MB functions other than those
+         of @ref CMPIBrokerExtFT.
+
+         The same CMPIContext object may be passed for any number of tasks,
+         including tasks that run at the same time; the MB attaches each
+         worker thread separately. The MB does not release @p ctx when a
+         task ends. The MI shall keep @p ctx valid until all tasks submitted
+         with it have ended, and is responsible for releasing it afterwards
+         if it owns it (e.g. if it has created it using
+         CMPIContextFT.clone()).
+     @endparblock
+     @param task Points to the function to be run as a task. For details, see
+         type @ref CMPIThreadFunc.
+     @param parm Points to argument(s) to be passed to that function.
+     @param [out] handle If not NULL, points to a task handle that upon
+         success will have been updated with the handle of the submitted task.
+         A task handle shall be passed to CMPIBrokerExtFT.waitTask() exactly
+         once. If NULL, the task runs detached, and its return value is
+         discarded.
+     @return @parblock
+         If successful, zero will be returned.
+
+         If not successful, a non-zero error code will be returned.
+     @endparblock
+     @errors
+     Error codes are defined in `errno.h`, which is defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1". Specifically, `EAGAIN` indicates
+     that the task queue of the thread pool is full, and `ENOSYS` indicates
+     that the MB does not provide a thread pool.
+     @convfunction None.
+     @capopsys
+     @added220
+    */
+    int (*submitTask) (const CMPIContext* ctx, CMPIThreadFunc task,
+        void* parm, CMPI_TASK_TYPE* handle);
+
+    /**
+     @brief Wait until a task submitted to the MB thread pool has ended.
+
+     CMPIBrokerExtFT.waitTask() suspends the current thread to wait until the
+     specified task has ended, and releases the task handle. If the task has
+     not yet started, the current thread waits until a worker thread of the
+     thread pool has run it; the current thread does not run the task
+     itself.
+
+     Consequently, a task shall not wait for a task that was submitted after
+     itself, since that may deadlock when all worker threads are busy.
 
-     CMPIBrokerExtFT.destroyCondition() destroys a POSIX threading-conformant
-     condition variable.
+     @param handle Handle of the task to wait for, as returned by
+         CMPIBrokerExtFT.submitTask().
+     @param [out] retval If not NULL, points to the return value of the task.
+         On successful completion, the return value of the task will be stored
+         in this location.
+     @return @parblock
+         If successful, zero will be returned.
 
-     @param cond Handle of the condition variable to be destroyed.
-     @return None.
+         If not successful, a non-zero error code will be returned.
+     @endparblock
      @errors
-     For historical reasons, this function does not indicate whether it
-     succeeded or failed.
+     Error codes are defined in `errno.h`, which is defined in
+     @ref ref-ieee-1003-1 "IEEE 1003.1". Specifically, `EINVAL` indicates
+     that @p handle is not a valid task handle or has already been passed to
+     this function, and `EDEADLK` indicates that the current thread is
+     running the task specified by @p handle.
      @convfunction None.
      @capopsys
-     @required200
-     @deprecated This function is deprecated since CMPI 2.1,
-         because it does not indicate whether it succeeded or failed. Use
-         CMPIBrokerExtFT.destroyCondition2() instead.
+     @added220
     */
-    void (*destroyCondition) (CMPI_COND_TYPE cond);
+    int (*waitTask) (CMPI_TASK_TYPE handle, CMPI_THREAD_RETURN* retval);
 
     /**
-     @brief Wait until a POSIX threading-conformant condition variable is
-         signalled.
+     @brief Get the number of worker threads in the MB thread pool.
 
-     CMPIBrokerExtFT.condWait() waits until a POSIX threading-conformant
-     condition variable is signaled. If the condition variable has been
-     signaled already, the function returns immediately; otherwise, it
-     suspends the current thread to wait for the signal and then returns.
+     CMPIBrokerExtFT.getPoolSize() gets the number of worker threads in the
+     thread pool of the MB. MIs can use it to decide into how many tasks to
+     split their work.
 
-     @param cond Handle of the condition variable to be used.
-     @param mutex Handle of a locked mutex guarding this condition
-         variable.
      @return @parblock
-         If successful, zero will be returned.
+         The number of worker threads will be returned.
 
-         If not successful, a non-zero error code will be returned.
+         If the MB does not provide a thread pool, zero will be returned.
      @endparblock
      @errors
-     Error codes are defined in `errno.h`, specifically for the
-    ``pthread_cond_wait()`` function; both are defined in
-     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     No additional error information is passed back.
      @convfunction None.
      @capopsys
-     @required200
+     @added220
     */
-    int (*condWait) (CMPI_COND_TYPE cond, CMPI_MUTEX_TYPE mutex);
+    unsigned int (*getPoolSize) (void);
 
     /**
-     @brief Wait until a POSIX threading-conformant condition variable is
-         signaled using a timeout value.
+     *   @}
+     *   @addtogroup brokerext-rwlock
+     *   @{
+     */
 
-     CMPIBrokerExtFT.timedCondWait() waits until a POSIX threading-conformant
-     condition variable is signalled. If the condition variable has been
-     signalled already, the function returns immediately; otherwise, it
-     suspends the current thread to wait for the signal and then returns. The
-     function returns when the timeout expires before the condition is
-     signalled.
+    /**
+     @brief Create a POSIX threading-conformant reader-writer lock.
 
-     @param cond Handle of the condition variable to be used.
-     @param mutex Handle of a locked mutex guarding this condition variable.
-     @param wait Timeout value. See structure ``timespec`` defined in `time.h`
-         for details; both are defined in @ref ref-ieee-1003-1 "IEEE 1003.1".
+     CMPIBrokerExtFT.newRWLock() creates a POSIX threading-conformant
+     reader-writer lock. A reader-writer lock can be held by any number of
+     readers at the same time, or by one writer. This allows read-mostly
+     data such as caches to be read concurrently by multiple threads.
+
+     The reader-writer lock is not recursive: A thread that holds the lock
+     shall not attempt to lock it again before unlocking it.
+
+     @param opt For future use. It should be ignored by the MB, and MIs should
+         pass a value of 0.
      @return @parblock
-         If successful, zero will be returned.
+         If successful, the handle of the new reader-writer lock will be
+         returned.
 
-         If not successful, a non-zero error code will be returned.
+         If not successful, NULL will be returned.
      @endparblock
      @errors
-     Error codes are defined in `errno.h`, specifically for the
-     ``pthread_cond_timedwait()`` function; both are defined in
-     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     No additional error information is passed back.
      @convfunction None.
      @capopsys
-     @required200
+     @added220
     */
-    int (*timedCondWait) (CMPI_COND_TYPE cond, CMPI_MUTEX_TYPE mutex,
-        struct timespec* wait);
+    CMPI_RWLOCK_TYPE (*newRWLock) (int opt);
 
     /**
-     @brief Send a signal to a POSIX threading-conformant condition variable.
+     @brief Destroy a POSIX threading-conformant reader-writer lock.
 
-     CMPIBrokerExtFT.signalCondition() sends a signal to a POSIX
-     threading-conformant condition variable.
+     CMPIBrokerExtFT.destroyRWLock() destroys a POSIX threading-conformant
+     reader-writer lock.
 
-     @param cond Handle of the target condition variable.
+     @param rwlock Handle of the reader-writer lock.
      @return @parblock
          If successful, zero will be returned.
 
@@ -3487,29 +4512,24 @@ typedef struct _CMPIBrokerExtFT {
      @endparblock
      @errors
      Error codes are defined in `errno.h`, specifically for the
-     ``pthread_cond_signal()`` function; both are defined in
+     ``pthread_rwlock_destroy()`` function; both are defined in
      @ref ref-ieee-1003-1 "IEEE 1003.1".
      @convfunction None.
      @capopsys
-     @required200
+     @added220
     */
-    int (*signalCondition) (CMPI_COND_TYPE cond);
+    int (*destroyRWLock) (CMPI_RWLOCK_TYPE rwlock);
 
     /**
-     *   @}
-     *   @addtogroup brokerext-mutex
-     *   @{
-     */
-
-#ifdef CMPI_VER_210
+     @brief Lock a POSIX threading-conformant reader-writer lock for reading.
 
-    /**
-     @brief Destroy a POSIX threading-conformant mutex.
+     CMPIBrokerExtFT.readLock() locks a POSIX threading-conformant
+     reader-writer lock for reading.
 
-     CMPIBrokerExtFT.destroyMutex2() destroys a POSIX threading-conformant
-     mutex.
+     If the lock is held by a writer, the current thread is suspended until
+     the lock is granted.
 
-     @param mutex Handle of the mutex to be destroyed.
+     @param rwlock Handle of the reader-writer lock.
      @return @parblock
          If successful, zero will be returned.
 
@@ -3517,28 +4537,24 @@ typedef struct _CMPIBrokerExtFT {
      @endparblock
      @errors
      Error codes are defined in `errno.h`, specifically for the
-     ``pthread_mutex_destroy()`` function; both are defined in
+     ``pthread_rwlock_rdlock()`` function; both are defined in
      @ref ref-ieee-1003-1 "IEEE 1003.1".
      @convfunction None.
      @capopsys
-     @added210 Supersedes the deprecated CMPIBrokerExtFT.destroyMutex()
-         function.
-     @required210
+     @added220
     */
-    int (*destroyMutex2) (CMPI_MUTEX_TYPE mutex);
+    int (*readLock) (CMPI_RWLOCK_TYPE rwlock);
 
     /**
-     @brief Lock a POSIX threading-conformant mutex.
-
-     CMPIBrokerExtFT.lockMutex2() locks a POSIX threading conformant mutex.
+     @brief Lock a POSIX threading-conformant reader-writer lock for writing.
 
-     If the mutex is locked by another thread, the current thread is suspended
-     until the lock is granted.
+     CMPIBrokerExtFT.writeLock() locks a POSIX threading-conformant
+     reader-writer lock for writing.
 
-     The behavior in case the mutex is already locked by the current thread
-     is defined in the description of CMPIBrokerExtFT.newMutex().
+     If the lock is held by any reader or by a writer, the current thread is
+     suspended until the lock is granted.
 
-     @param mutex Handle of the mutex to be locked.
+     @param rwlock Handle of the reader-writer lock.
      @return @parblock
          If successful, zero will be returned.
 
@@ -3546,24 +4562,22 @@ typedef struct _CMPIBrokerExtFT {
      @endparblock
      @errors
      Error codes are defined in `errno.h`, specifically for the
-     ``pthread_mutex_lock()`` function; both are defined in
+     ``pthread_rwlock_wrlock()`` function; both are defined in
      @ref ref-ieee-1003-1 "IEEE 1003.1".
      @convfunction None.
      @capopsys
-     @added210 Supersedes the deprecated CMPIBrokerExtFT.lockMutex() function.
-     @required210
+     @added220
     */
-    int (*lockMutex2) (CMPI_MUTEX_TYPE mutex);
+    int (*writeLock) (CMPI_RWLOCK_TYPE rwlock);
 
     /**
-     @brief Unlock a POSIX threading-conformant mutex.
-
-     CMPIBrokerExtFT.unlockMutex2() unlocks a POSIX threading conformant mutex.
+     @brief Unlock a POSIX threading-conformant reader-writer lock.
 
-     The behavior in case the mutex is not locked by the current thread is
-     defined in the description of CMPIBrokerExtFT.newMutex().
+     CMPIBrokerExtFT.unlockRW() releases the lock on a POSIX
+     threading-conformant reader-writer lock that is held by the current
+     thread, for reading or for writing.
 
-     @param mutex Handle of the mutex to be unlocked.
+     @param rwlock Handle of the reader-writer lock.
      @return @parblock
          If successful, zero will be returned.
 
@@ -3571,46 +4585,70 @@ typedef struct _CMPIBrokerExtFT {
      @endparblock
      @errors
      Error codes are defined in `errno.h`, specifically for the
-     ``pthread_mutex_lock()`` function; both are defined in
+     ``pthread_rwlock_unlock()`` function; both are defined in
      @ref ref-ieee-1003-1 "IEEE 1003.1".
      @convfunction None.
      @capopsys
-     @added210 Supersedes the deprecated CMPIBrokerExtFT.unlockMutex() function.
-     @required210
+     @added220
     */
-    int (*unlockMutex2) (CMPI_MUTEX_TYPE mutex);
+    int (*unlockRW) (CMPI_RWLOCK_TYPE rwlock);
 
     /**
      *   @}
-     *   @addtogroup brokerext-condition
+     *   @addtogroup brokerext-atomic
      *   @{
      */
 
     /**
-     @brief Destroy a POSIX threading-conformant condition variable.
+     @brief Atomically add a value to an integer.
 
-     CMPIBrokerExtFT.destroyCondition2() destroys a POSIX threading-conformant
-     condition variable.
+     CMPIBrokerExtFT.atomicFetchAdd() atomically adds a value to the integer
+     at the specified location, and returns the previous value of that
+     integer. The operation is sequentially consistent.
 
-     @param cond Handle of the condition variable to be destroyed.
-     @return @parblock
-         If successful, zero will be returned.
+     @param ptr Points to the integer to be modified.
+     @param value Value to be added to the integer. It may be negative.
+     @return The value of the integer before the addition.
+     @errors
+     No error information is passed back; the function always succeeds.
+     @convfunction None.
+     @capopsys
+     @added220
+    */
+    CMPI_ATOMIC_TYPE (*atomicFetchAdd) (volatile CMPI_ATOMIC_TYPE* ptr,
+        CMPI_ATOMIC_TYPE value);
 
-         If not successful, a non-zero error code will be returned.
+    /**
+     @brief Atomically compare and exchange an integer.
+
+     CMPIBrokerExtFT.atomicCompareExchange() atomically compares the integer
+     at the specified location with an expected value and, if they are equal,
+     replaces the integer with a desired value. The operation is sequentially
+     consistent.
+
+     @param ptr Points to the integer to be modified.
+     @param [in,out] expected Points to the expected value of the integer. If
+         the integer is not equal to the expected value, the current value of
+         the integer will have been stored in this location upon return.
+     @param desired Value to be stored in the integer if it is equal to the
+         expected value.
+     @return @parblock
+         A @ref CMPIBoolean value indicating the result will be returned, as
+         follows:
+         @li True indicates that the integer was equal to the expected value
+             and has been replaced with @p desired;
+         @li False indicates that this is not the case.
      @endparblock
      @errors
-     Error codes are defined in `errno.h`, specifically for the
-     ``pthread_cond_destroy()`` function; both are defined in
-     @ref ref-ieee-1003-1 "IEEE 1003.1".
+     No error information is passed back; the function always succeeds.
      @convfunction None.
      @capopsys
-     @added210 Supersedes the deprecated CMPIBrokerExtFT.destroyCondition()
-         function.
-     @required210
+     @added220
     */
-    int (*destroyCondition2) (CMPI_COND_TYPE cond);
+    CMPIBoolean (*atomicCompareExchange) (volatile CMPI_ATOMIC_TYPE* ptr,
+        CMPI_ATOMIC_TYPE* expected, CMPI_ATOMIC_TYPE desired);
 
-#endif /*CMPI_VER_210*/
+#endif /*CMPI_VER_220*/
 
     /**
      *   @}
@@ -4049,30 +5087,345 @@ typedef struct _CMPIBrokerMemFT {
      Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard").
 
      @param mb Points to a CMPIBroker structure.
-     @param chars Points to the C-language string to be released. This
-         C-language string shall have been created using
-         CMPIStringFT.newCharsCP().
-     @return None.
-     @convfunction CMFreeChars()
-     @capmemory This function can be implemented only if the @ref cap-querynorm
-         "Query Normalization" capability is supported as well.
-     @added210
-     @bug The @ref ref-cmpi-standard "CMPI Standard" misses to document the
-         additional precondition of supporting the @ref cap-codepage
-         "Codepage Conversion" capability, for implementing this function. That
-         should be added.
-    */
-    void (*freeChars) (const CMPIBroker* mb, char* chars);
+     @param chars Points to the C-language string to be released. This
+         C-language string shall have been created using
+         CMPIStringFT.newCharsCP().
+     @return None.
+     @convfunction CMFreeChars()
+     @capmemory This function can be implemented only if the @ref cap-querynorm
+         "Query Normalization" capability is supported as well.
+     @added210
+     @bug The @ref ref-cmpi-standard "CMPI Standard" misses to document the
+         additional precondition of supporting the @ref cap-codepage
+         "Codepage Conversion" capability, for implementing this function. That
+         should be added.
+    */
+    void (*freeChars) (const CMPIBroker* mb, char* chars);
+
+#endif /*CMPI_VER_210*/
+
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Mark a new arena-scoped object lifecycle level for subsequent
+         newly created CMPI encapsulated data type objects.
+
+     CMPIBrokerMemFT.markArena() marks a new object lifecycle level for the
+     calling thread, whose objects are allocated from a memory arena.
+     Subsequent newly created CMPI encapsulated data type objects in that
+     thread will be associated with that new object lifecycle level, until
+     CMPIBrokerMemFT.release() is invoked with the returned @ref CMPIGcStat
+     pointer.
+
+     An arena-scoped object lifecycle level differs from one marked by
+     CMPIBrokerMemFT.mark() as follows:
+
+     @li It applies only to objects created in the thread that invoked this
+         function. Objects created in other threads are not associated with
+         it.
+     @li The MB allocates its objects from a region that is private to the
+         calling thread, and CMPIBrokerMemFT.release() reclaims the memory of
+         all of its objects at once, with a cost that does not depend on the
+         number of objects.
+     @li Releasing its objects individually (using the `release()` function
+         of their function tables, or the `free...()` functions in this
+         function table) is permitted but has no effect; their memory is
+         reclaimed only when the level is released.
+     @li Objects created using `clone()` are not associated with the level,
+         and remain valid after it has been released. Cloning an object is
+         therefore the way to keep it beyond the level.
+
+     Objects passed to the MB (e.g. using CMPIResultFT.returnInstance()) are
+     copied by the MB as needed, so an object associated with an arena-scoped
+     level may be passed to the MB and released afterwards.
+
+     The markArena(), mark() and release() function calls may be stacked,
+     following the rules described for CMPIBrokerMemFT.mark(). Objects
+     created while an inner level marked by CMPIBrokerMemFT.mark() is active
+     are associated with that inner level, and are not allocated from the
+     arena.
+
+     @param mb Points to a CMPIBroker structure.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to a @ref CMPIGcStat structure will be
+         returned, for use with CMPIBrokerMemFT.release().
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb handle is invalid
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @li `CMPI_RC_ERR_FAILED` - Other error occurred.
+     @convfunction CMMemMarkArena()
+     @capmemarena
+     @added220
+    */
+    CMPIGcStat* (*markArena) (const CMPIBroker* mb, CMPIStatus* rc);
+
+#endif /*CMPI_VER_220*/
+
+    /**
+     *   @}
+     */
+
+} CMPIBrokerMemFT;
+
+#endif /*CMPI_VER_200*/
+
+#ifdef CMPI_VER_220
+
+/**
+ * @brief Function table for MB asynchronous client services.
+ *
+ * This function table is referenced by the CMPIBroker structure, and provides
+ * @ref broker-async "Asynchronous Client Services".
+ *
+ * Each function in this table initiates the same up-call as the function of
+ * the same name (without the `Async` suffix) in @ref CMPIBrokerFT, but
+ * returns as soon as the MB has accepted the up-call. When the up-call has
+ * completed, the MB calls the completion function passed by the MI (see
+ * @ref CMPICompletionFunc) on a thread of its choice, with the result of the
+ * up-call. This allows an MI to have several up-calls in progress at the
+ * same time, so that the latency of a fan-out to multiple MIs is that of the
+ * slowest up-call, instead of the sum of all up-calls.
+ *
+ * The following rules apply to all functions in this table:
+ * @li Any objects passed in to the function (other than @p parm) are used by
+ *     the MB only during the call to the function.
+ * @li The completion function is called on a thread that is attached to the
+ *     MB, so it may use MB services, including further up-calls.
+ * @li Any objects in the result passed to the completion function will be
+ *     automatically released by the MB when the completion function returns.
+ *     The completion function needs to clone any objects it wants to keep.
+ * @li An MI function that initiates asynchronous up-calls shall not return
+ *     before the completion functions of all of them have been called. The
+ *     MI may use @ref brokerext-condition "conditions" to wait for that.
+ *
+ * @capasync
+ * @added220
+ */
+typedef struct _CMPIBrokerAsyncFT {
+
+    /**
+     * @brief CMPI version supported by the MB for this function table.
+     *
+     * Any earlier CMPI versions are implicitly also supported.
+     *
+     * See @ref sym-version-nnn "CMPIVersion\<NNN\>" for valid CMPI
+     * version numbers.
+     */
+    CMPIVersion ftVersion;
+
+    /**
+     *   @addtogroup broker-async
+     *   @{
+     */
+
+    /**
+     @brief Get an existing instance, asynchronously.
+
+     CMPIBrokerAsyncFT.getInstanceAsync() initiates an asynchronous
+     CMPIBrokerFT.getInstance() up-call. The retrieved instance is passed to
+     @p cb as a @ref CMPI_instance value.
+
+     @param mb Points to a CMPIBroker structure.
+     @param ctx Points to a CMPIContext object, with the same requirements as
+         for the corresponding function of @ref CMPIBrokerFT. The MB uses the
+         context data only during this call, so the MI may release @p ctx
+         afterwards.
+     @param instPath Points to a CMPIObjectPath object that references the
+         instance to be retrieved, as for CMPIBrokerFT.getInstance().
+     @param properties If not NULL, is an array of zero or more pointers to
+         strings, each specifying a property name, as for
+         CMPIBrokerFT.getInstance().
+     @param cb Points to the completion function that will be called by the
+         MB when the up-call has completed. See @ref CMPICompletionFunc.
+     @param parm A pointer to arbitrary data that will be passed to @p cb.
+     @return CMPIStatus structure containing the function return status.
+         If the status indicates success, the up-call has been accepted and
+         @p cb will be called exactly once; otherwise, @p cb will not be
+         called.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful; the up-call has been accepted.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb or @p ctx handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p cb is NULL.
+     @li `CMPI_RC_ERR_SERVER_LIMITS_EXCEEDED` - The MB cannot accept more
+         asynchronous up-calls at this time.
+
+     All other return codes of the corresponding function of
+     @ref CMPIBrokerFT are passed to @p cb.
+     @convfunction CBGetInstanceAsync()
+     @capread
+     @capasync
+     @added220
+    */
+    CMPIStatus (*getInstanceAsync) (const CMPIBroker* mb,
+        const CMPIContext* ctx, const CMPIObjectPath* instPath,
+        const char** properties, CMPICompletionFunc cb, void* parm);
+
+    /**
+     @brief Enumerate the instances of a given class (and subclasses),
+         asynchronously.
+
+     CMPIBrokerAsyncFT.enumerateInstancesAsync() initiates an asynchronous
+     CMPIBrokerFT.enumerateInstances() up-call. The enumerated instances are
+     passed to @p cb as a @ref CMPI_enumeration value.
+
+     @param mb Points to a CMPIBroker structure.
+     @param ctx Points to a CMPIContext object, with the same requirements as
+         for the corresponding function of @ref CMPIBrokerFT. The MB uses the
+         context data only during this call, so the MI may release @p ctx
+         afterwards.
+     @param classPath Points to a CMPIObjectPath object that references the
+         given class, as for CMPIBrokerFT.enumerateInstances().
+     @param properties If not NULL, is an array of zero or more pointers to
+         strings, each specifying a property name, as for
+         CMPIBrokerFT.enumerateInstances().
+     @param cb Points to the completion function that will be called by the
+         MB when the up-call has completed. See @ref CMPICompletionFunc.
+     @param parm A pointer to arbitrary data that will be passed to @p cb.
+     @return CMPIStatus structure containing the function return status.
+         If the status indicates success, the up-call has been accepted and
+         @p cb will be called exactly once; otherwise, @p cb will not be
+         called.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful; the up-call has been accepted.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb or @p ctx handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p cb is NULL.
+     @li `CMPI_RC_ERR_SERVER_LIMITS_EXCEEDED` - The MB cannot accept more
+         asynchronous up-calls at this time.
+
+     All other return codes of the corresponding function of
+     @ref CMPIBrokerFT are passed to @p cb.
+     @convfunction CBEnumInstancesAsync()
+     @capread
+     @capasync
+     @added220
+    */
+    CMPIStatus (*enumerateInstancesAsync) (const CMPIBroker* mb,
+        const CMPIContext* ctx, const CMPIObjectPath* classPath,
+        const char** properties, CMPICompletionFunc cb, void* parm);
+
+    /**
+     @brief Enumerate the instances associated with a given source instance,
+         asynchronously.
+
+     CMPIBrokerAsyncFT.associatorsAsync() initiates an asynchronous
+     CMPIBrokerFT.associators() up-call. The associated instances are passed
+     to @p cb as a @ref CMPI_enumeration value.
+
+     @param mb Points to a CMPIBroker structure.
+     @param ctx Points to a CMPIContext object, with the same requirements as
+         for the corresponding function of @ref CMPIBrokerFT. The MB uses the
+         context data only during this call, so the MI may release @p ctx
+         afterwards.
+     @param instPath Points to a CMPIObjectPath object that references the
+         source instance, as for CMPIBrokerFT.associators().
+     @param assocClass If not NULL, the association class that filters the
+         result, as for CMPIBrokerFT.associators().
+     @param resultClass If not NULL, the class that filters the result, as
+         for CMPIBrokerFT.associators().
+     @param role If not NULL, the role of the source instance, as for
+         CMPIBrokerFT.associators().
+     @param resultRole If not NULL, the role of the returned instances, as
+         for CMPIBrokerFT.associators().
+     @param properties If not NULL, is an array of zero or more pointers to
+         strings, each specifying a property name, as for
+         CMPIBrokerFT.associators().
+     @param cb Points to the completion function that will be called by the
+         MB when the up-call has completed. See @ref CMPICompletionFunc.
+     @param parm A pointer to arbitrary data that will be passed to @p cb.
+     @return CMPIStatus structure containing the function return status.
+         If the status indicates success, the up-call has been accepted and
+         @p cb will be called exactly once; otherwise, @p cb will not be
+         called.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful; the up-call has been accepted.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb or @p ctx handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p cb is NULL.
+     @li `CMPI_RC_ERR_SERVER_LIMITS_EXCEEDED` - The MB cannot accept more
+         asynchronous up-calls at this time.
+
+     All other return codes of the corresponding function of
+     @ref CMPIBrokerFT are passed to @p cb.
+     @convfunction CBAssociatorsAsync()
+     @capassociations
+     @capasync
+     @added220
+    */
+    CMPIStatus (*associatorsAsync) (const CMPIBroker* mb,
+        const CMPIContext* ctx, const CMPIObjectPath* instPath,
+        const char* assocClass, const char* resultClass, const char* role,
+        const char* resultRole, const char** properties,
+        CMPICompletionFunc cb, void* parm);
+
+    /**
+     @brief Invoke a method on a target object, asynchronously.
+
+     CMPIBrokerAsyncFT.invokeMethodAsync() initiates an asynchronous
+     CMPIBrokerFT.invokeMethod() up-call. The method return value is passed
+     to @p cb.
+
+     @param mb Points to a CMPIBroker structure.
+     @param ctx Points to a CMPIContext object, with the same requirements as
+         for the corresponding function of @ref CMPIBrokerFT. The MB uses the
+         context data only during this call, so the MI may release @p ctx
+         afterwards.
+     @param objPath Points to a CMPIObjectPath object that references the
+         target object, as for CMPIBrokerFT.invokeMethod().
+     @param method Method name.
+     @param in Points to a CMPIArgs object containing the method input
+         parameters. The MB uses @p in only during this call.
+     @param [out] out Points to an empty CMPIArgs object that will have been
+         updated to contain the method output parameters when @p cb is
+         called. The MI shall not access or release @p out before that.
+     @param cb Points to the completion function that will be called by the
+         MB when the up-call has completed. See @ref CMPICompletionFunc.
+     @param parm A pointer to arbitrary data that will be passed to @p cb.
+     @return CMPIStatus structure containing the function return status.
+         If the status indicates success, the up-call has been accepted and
+         @p cb will be called exactly once; otherwise, @p cb will not be
+         called.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful; the up-call has been accepted.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p mb or @p ctx handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p cb is NULL.
+     @li `CMPI_RC_ERR_SERVER_LIMITS_EXCEEDED` - The MB cannot accept more
+         asynchronous up-calls at this time.
 
-#endif /*CMPI_VER_210*/
+     All other return codes of the corresponding function of
+     @ref CMPIBrokerFT are passed to @p cb.
+     @convfunction CBInvokeMethodAsync()
+     @capmanipulation
+     @capasync
+     @added220
+    */
+    CMPIStatus (*invokeMethodAsync) (const CMPIBroker* mb,
+        const CMPIContext* ctx, const CMPIObjectPath* objPath,
+        const char* method, const CMPIArgs* in, CMPIArgs* out,
+        CMPICompletionFunc cb, void* parm);
 
     /**
      *   @}
      */
 
-} CMPIBrokerMemFT;
+} CMPIBrokerAsyncFT;
 
-#endif /*CMPI_VER_200*/
+#endif /*CMPI_VER_220*/
 
 /**
  * @}
@@ -4334,6 +5687,20 @@ typedef struct _CMPIContextFT {
  * CMPI enables an MB to actively accept result data as it is generated, using
  * the CMPIResult encapsulated data type.
  *
+ * The MB may abort a request, or stop needing its results, before the MI has
+ * returned all of them (e.g. because the client has cancelled the request).
+ * From then on, the functions adding results to the CMPIResult object of
+ * that request, and CMPIResultFT.returnDone(), fail as follows:
+ * @li If the @p miVersion member of the function table of the MI that was
+ *     invoked for the request is 220 or higher, they fail with
+ *     `CMPI_RC_ERR_ABORTED`.
+ * @li Otherwise, they fail with `CMPI_RC_ERR_INVALID_HANDLE`, as in CMPI
+ *     versions before 2.2, since that MI has no definition for
+ *     `CMPI_RC_ERR_ABORTED`.
+ *
+ * Since CMPI 2.2, MIs can also test for this condition using
+ * CMPIResultFT.isCancelled().
+ *
  * For more details, see Subclause 8.2 of the
  * @ref ref-cmpi-standard "CMPI Standard".
  */
@@ -4434,13 +5801,19 @@ typedef struct _CMPIResultFT {
      The function return status will indicate one of the following @ref CMPIrc
      codes:
      @li `CMPI_RC_OK` - Function successful.
-     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid,
-         or the MB has aborted the request operation for which this data is
-         being returned.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid, or
+         the MB has aborted the request for which this data is returned and
+         the MI has an @p miVersion below 220 (see @ref CMPIResult).
      @li `CMPI_RC_ERR_INVALID_DATA_TYPE` - An attempt to return a data type
          that is not allowed for this MI function invocation or @p type is not
          recognized.
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         data is returned, or does not need any further data for it (e.g.
+         because the client has cancelled it), and the MI has an
+         @p miVersion of 220 or higher (see @ref CMPIResult). The MI should
+         stop producing results and return from the MI function.
      @convfunction CMReturnData()
+     @changed220 In CMPI 2.2, added the return code `CMPI_RC_ERR_ABORTED`.
     */
     CMPIStatus (*returnData) (const CMPIResult* rslt, const CMPIValue* value,
         const CMPIType type);
@@ -4459,9 +5832,16 @@ typedef struct _CMPIResultFT {
      The function return status will indicate one of the following @ref CMPIrc
      codes:
      @li `CMPI_RC_OK` - Function successful.
-     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid or the MB
-         has aborted the request for which this data is returned.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid, or
+         the MB has aborted the request for which this data is returned and
+         the MI has an @p miVersion below 220 (see @ref CMPIResult).
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         data is returned, or does not need any further data for it (e.g.
+         because the client has cancelled it), and the MI has an
+         @p miVersion of 220 or higher (see @ref CMPIResult). The MI should
+         stop producing results and return from the MI function.
      @convfunction CMReturnInstance()
+     @changed220 In CMPI 2.2, added the return code `CMPI_RC_ERR_ABORTED`.
     */
     CMPIStatus (*returnInstance) (const CMPIResult* rslt,
         const CMPIInstance* inst);
@@ -4480,10 +5860,17 @@ typedef struct _CMPIResultFT {
      The function return status will indicate one of the following @ref CMPIrc
      codes:
      @li `CMPI_RC_OK` - Function successful.
-     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt or @p op handle is invalid,
-         or the MB has aborted the request for which this data is being
-         returned.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt or @p op handle is
+         invalid, or the MB has aborted the request for which this data is
+         returned and the MI has an @p miVersion below 220 (see
+         @ref CMPIResult).
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         data is returned, or does not need any further data for it (e.g.
+         because the client has cancelled it), and the MI has an
+         @p miVersion of 220 or higher (see @ref CMPIResult). The MI should
+         stop producing results and return from the MI function.
      @convfunction CMReturnObjectPath()
+     @changed220 In CMPI 2.2, added the return code `CMPI_RC_ERR_ABORTED`.
     */
     CMPIStatus (*returnObjectPath) (const CMPIResult* rslt,
         const CMPIObjectPath* op);
@@ -4501,9 +5888,14 @@ typedef struct _CMPIResultFT {
      The function return status will indicate one of the following @ref CMPIrc
      codes:
      @li `CMPI_RC_OK` - Function successful.
-     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid,
-         or the MB has aborted the request for which this result is defined.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid, or
+         the MB has aborted the request for which this result is defined and
+         the MI has an @p miVersion below 220 (see @ref CMPIResult).
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         result is defined, or does not need any further data for it, and
+         the MI has an @p miVersion of 220 or higher (see @ref CMPIResult).
      @convfunction CMReturnDone()
+     @changed220 In CMPI 2.2, added the return code `CMPI_RC_ERR_ABORTED`.
     */
     CMPIStatus (*returnDone) (const CMPIResult* rslt);
 
@@ -4542,16 +5934,163 @@ typedef struct _CMPIResultFT {
      The function return status will indicate one of the following @ref CMPIrc
      codes:
      @li `CMPI_RC_OK` - Function successful.
-     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid or the MB
-         has aborted the request for which this data is returned.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid, or
+         the MB has aborted the request for which this data is returned and
+         the MI has an @p miVersion below 220 (see @ref CMPIResult).
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         data is returned, or does not need any further data for it, and the
+         MI has an @p miVersion of 220 or higher (see @ref CMPIResult).
      @convfunction CMReturnError()
      @caperrors
      @added200
+     @changed220 In CMPI 2.2, added the return code `CMPI_RC_ERR_ABORTED`.
     */
     CMPIStatus (*returnError) (const CMPIResult* rslt, const CMPIError* er);
 
 #endif /*CMPI_VER_200*/
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Add an array of instances to a CMPIResult object.
+
+     CMPIResultFT.returnInstances() adds a sequence of instances to be
+     returned to the MB, to a CMPIResult object.
+
+     The effect is the same as calling CMPIResultFT.returnInstance() for each
+     instance in @p insts, in array order, except that the MB can perform its
+     per-call processing (e.g. serialization of access to the result) once
+     for the entire sequence.
+
+     If an error occurs for one of the instances, the instances preceding it
+     in @p insts have been added to the CMPIResult object, and the instances
+     following it have not been added.
+
+     @param rslt Points to the CMPIResult object for this function.
+     @param insts Points to an array of @p n pointers to CMPIInstance objects
+         representing the instances to be returned. The array and the
+         CMPIInstance objects remain owned by the MI and may be released by
+         the MI right after this function returns.
+     @param n Number of entries in @p insts. A value of 0 is valid and causes
+         no instance to be added.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle or one of the
+         instance handles in @p insts is invalid, or the MB has aborted the
+         request for which this data is returned and the MI has an
+         @p miVersion below 220 (see @ref CMPIResult).
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p insts is NULL and @p n is
+         not 0.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         data is returned, or does not need any further data for it (e.g.
+         because the client has cancelled it), and the MI has an
+         @p miVersion of 220 or higher (see @ref CMPIResult). The MI should
+         stop producing results and return from the MI function.
+     @convfunction CMReturnInstances()
+     @capbatchresults
+     @added220
+    */
+    CMPIStatus (*returnInstances) (const CMPIResult* rslt,
+        const CMPIInstance* const* insts, CMPICount n);
+
+    /**
+     @brief Add an array of object paths to a CMPIResult object.
+
+     CMPIResultFT.returnObjectPaths() adds a sequence of object paths to be
+     returned to the MB, to a CMPIResult object.
+
+     The effect is the same as calling CMPIResultFT.returnObjectPath() for
+     each object path in @p ops, in array order, except that the MB can
+     perform its per-call processing once for the entire sequence.
+
+     If an error occurs for one of the object paths, the object paths
+     preceding it in @p ops have been added to the CMPIResult object, and the
+     object paths following it have not been added.
+
+     @param rslt Points to the CMPIResult object for this function.
+     @param ops Points to an array of @p n pointers to CMPIObjectPath objects
+         representing the object paths to be returned. The array and the
+         CMPIObjectPath objects remain owned by the MI and may be released by
+         the MI right after this function returns.
+     @param n Number of entries in @p ops. A value of 0 is valid and causes
+         no object path to be added.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle or one of the
+         object path handles in @p ops is invalid, or the MB has aborted the
+         request for which this data is returned and the MI has an
+         @p miVersion below 220 (see @ref CMPIResult).
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p ops is NULL and @p n is not 0.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @li `CMPI_RC_ERR_ABORTED` - The MB has aborted the request for which this
+         data is returned, or does not need any further data for it (e.g.
+         because the client has cancelled it), and the MI has an
+         @p miVersion of 220 or higher (see @ref CMPIResult). The MI should
+         stop producing results and return from the MI function.
+     @convfunction CMReturnObjectPaths()
+     @capbatchresults
+     @added220
+    */
+    CMPIStatus (*returnObjectPaths) (const CMPIResult* rslt,
+        const CMPIObjectPath* const* ops, CMPICount n);
+
+    /**
+     @brief Test whether the MB needs further results in a CMPIResult object.
+
+     CMPIResultFT.isCancelled() tests whether the MB still needs further
+     results to be added to a CMPIResult object.
+
+     The MB may stop needing results before the MI has returned all of them;
+     for example, because the client has cancelled the request, has closed
+     a pull enumeration, or has already received the maximum number of
+     objects it requested. An MI that produces a large result set may call
+     this function periodically (e.g. before building each instance or each
+     batch of instances), and should return from the MI function as soon as
+     this function returns true, without calling CMPIResultFT.returnDone().
+     The function return status the MI returns in that case is ignored by the
+     MB.
+
+     Once this function has returned true for a CMPIResult object, it shall
+     return true for all subsequent calls for that object, and functions
+     adding results to that object shall fail as described for
+     @ref CMPIResult (that is, with `CMPI_RC_ERR_ABORTED` for MIs with an
+     @p miVersion of 220 or higher).
+
+     This function is intended to be cheap enough to be called for each result
+     produced by the MI.
+
+     @param rslt Points to the CMPIResult object for this function.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a CMPIBoolean value indicating whether the MB does not
+         need any further results in @p rslt will be returned.
+
+         If not successful, false will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p rslt handle is invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMIsCancelled()
+     @added220
+    */
+    CMPIBoolean (*isCancelled) (const CMPIResult* rslt, CMPIStatus* rc);
+
+#endif /*CMPI_VER_220*/
+
 } CMPIResultFT;
 
 /**
@@ -4950,6 +6489,131 @@ typedef struct _CMPIArrayFT {
     CMPIStatus (*setElementAt) (const CMPIArray* ar, CMPICount index,
         const CMPIValue* value, CMPIType type);
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Get the values of a range of array elements in a CMPIArray object
+         into a buffer.
+
+     CMPIArrayFT.getElements() gets the values of a range of array elements in
+     a CMPIArray object into a contiguous buffer of native C values.
+
+     This function is supported only for arrays whose simple base type is
+     a boolean, char16, real number or integer type (that is, whose array
+     type matches @ref CMPI_SIMPLEA, @ref CMPI_REALA or @ref CMPI_INTEGERA).
+     The buffer contains the values as consecutive C values of the C type
+     corresponding to the simple base type of the array (e.g.
+     @ref CMPIUint64 for @ref CMPI_uint64).
+
+     @param ar Points to the CMPIArray object for this function.
+     @param start Zero-based position of the first array element in the range.
+     @param count Number of array elements in the range. The range shall not
+         extend beyond the size of the array.
+     @param [out] buf Points to a buffer that upon success will have been
+         updated with the values of the array elements in the range. The
+         buffer shall have space for @p count values of the C type
+         corresponding to the simple base type of the array.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p ar handle is invalid.
+     @li `CMPI_RC_ERR_NO_SUCH_PROPERTY` - The range specified by @p start
+         and @p count extends beyond the size of the array.
+     @li `CMPI_RC_ERR_INVALID_DATA_TYPE` - The simple base type of @p ar is
+         not supported by this function.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p buf is NULL.
+     @li `CMPI_RC_ERR_FAILED` - An array element in the range is NULL. The
+         content of @p buf is undefined in this case. Use
+         CMPIArrayFT.getElementAt() for arrays with NULL elements.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMGetArrayElements()
+     @added220
+    */
+    CMPIStatus (*getElements) (const CMPIArray* ar, CMPICount start,
+        CMPICount count, void* buf);
+
+    /**
+     @brief Set the values of a range of existing array elements in a
+         CMPIArray object from a buffer.
+
+     CMPIArrayFT.setElements() sets the values of a range of existing array
+     elements in a CMPIArray object from a contiguous buffer of native C
+     values. All array elements in the range will have non-NULL values.
+
+     This function is supported for the same array types and uses the same
+     buffer format as CMPIArrayFT.getElements().
+
+     @param ar Points to the CMPIArray object for this function.
+     @param start Zero-based position of the first array element in the range.
+     @param count Number of array elements in the range. The range shall not
+         extend beyond the size of the array.
+     @param buf Points to a buffer containing @p count values of the C type
+         corresponding to the simple base type of the array. The values are
+         copied by this function, and the buffer may be freed by the MI right
+         after this function returns.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p ar handle is invalid.
+     @li `CMPI_RC_ERR_NO_SUCH_PROPERTY` - The range specified by @p start
+         and @p count extends beyond the size of the array.
+     @li `CMPI_RC_ERR_INVALID_DATA_TYPE` - The simple base type of @p ar is
+         not supported by this function.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p buf is NULL.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMSetArrayElements()
+     @added220
+    */
+    CMPIStatus (*setElements) (const CMPIArray* ar, CMPICount start,
+        CMPICount count, const void* buf);
+
+    /**
+     @brief Get read-only access to the internal buffer of a CMPIArray object.
+
+     CMPIArrayFT.getRawBuffer() gets a pointer to the internal buffer of a
+     CMPIArray object, which contains the values of all array elements in the
+     buffer format described for CMPIArrayFT.getElements().
+
+     An MB is not required to store arrays in that format. If it does not do
+     so for @p ar, or if @p ar has NULL elements, this function is not
+     successful and the MI needs to use CMPIArrayFT.getElements() or
+     CMPIArrayFT.getElementAt() instead.
+
+     @param ar Points to the CMPIArray object for this function.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to the internal buffer of @p ar will be
+         returned. It has CMPIArrayFT.getSize() values.
+
+         The buffer shall not be modified or freed by the MI. It remains valid
+         until @p ar is modified or released.
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p ar handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_DATA_TYPE` - The simple base type of @p ar is
+         not supported by this function.
+     @li `CMPI_RC_ERR_FAILED` - @p ar has NULL elements.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB, or the MB does not store @p ar in the required format.
+     @convfunction CMGetArrayRawBuffer()
+     @added220
+    */
+    const void* (*getRawBuffer) (const CMPIArray* ar, CMPIStatus* rc);
+
+#endif /*CMPI_VER_220*/
+
 } CMPIArrayFT;
 
 /**
@@ -4964,6 +6628,35 @@ typedef struct _CMPIArrayFT {
  * CMPIEnumeration objects are used to store the results of enumerating MB
  * functions, such as CMPIBrokerFT.enumerateInstances(), or
  * CMPIBrokerFT.associatorNames().
+ *
+ * If the MI specifies a @ref CMPIStreamingPageSize entry in the CMPIContext
+ * object passed to an enumerating MB function, the MB may return a
+ * *streaming enumeration*. A streaming enumeration does not hold all of its
+ * elements at once; it retrieves them from the target MI in pages of at most
+ * the requested page size, as they are consumed by
+ * CMPIEnumerationFT.getNext(). Streaming enumerations have the following
+ * specific behavior:
+ *
+ * @li The return status of the enumerating MB function reflects only errors
+ *     detected up to the delivery of the first page. Errors detected later
+ *     are returned by CMPIEnumerationFT.getNext() or
+ *     CMPIEnumerationFT.hasNext(), using the return codes of the enumerating
+ *     MB function.
+ * @li CMPIEnumerationFT.hasNext() may block until the next page has been
+ *     delivered by the target MI.
+ * @li CMPIEnumerationFT.toArray() returns only the elements of the current
+ *     page that have not yet been consumed, and consumes them. Memory use
+ *     therefore stays bounded by the page size. If further pages remain,
+ *     CMPIEnumerationFT.hasNext() returns true afterwards, so an MI that
+ *     needs all elements repeats CMPIEnumerationFT.toArray() until
+ *     CMPIEnumerationFT.hasNext() returns false.
+ * @li CMPIEnumerationFT.clone() is not supported and returns
+ *     `CMPI_RC_ERR_NOT_SUPPORTED`.
+ * @li Releasing the CMPIEnumeration object (explicitly, or automatically at
+ *     the end of the MI function invocation) before all elements have been
+ *     consumed ends the retrieval of further elements from the target MI.
+ *
+ * @changed220 In CMPI 2.2, added streaming enumerations.
  */
 typedef struct _CMPIEnumeration {
 
@@ -5022,6 +6715,10 @@ typedef struct _CMPIEnumerationFT {
      CMPIEnumerationFT.clone() creates an independent copy of a CMPIEnumeration
      object.
 
+     For enumerations returned by CMPIBrokerEncFT.readSnapshot(), the copy
+     shares the snapshot with the original object, and its cost does not
+     depend on the number of instances in the snapshot.
+
      @param en Points to the CMPIEnumeration object that is to be copied.
      @param [out] rc If not NULL, points to a CMPIStatus structure that upon
          return will have been updated with the function return status.
@@ -5039,7 +6736,13 @@ typedef struct _CMPIEnumerationFT {
      codes:
      @li `CMPI_RC_OK` - Function successful.
      @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p en handle is invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - @p en is a streaming enumeration (see
+         @ref edt-enumeration "CMPIEnumeration Support").
      @convfunction CMClone()
+     @changed220 In CMPI 2.2, specified the behavior for enumerations
+         returned by CMPIBrokerEncFT.readSnapshot(), and added the return code
+         `CMPI_RC_ERR_NOT_SUPPORTED` for streaming enumerations, which cannot
+         be copied.
     */
     CMPIEnumeration* (*clone) (const CMPIEnumeration* en, CMPIStatus* rc);
 
@@ -5067,6 +6770,10 @@ typedef struct _CMPIEnumerationFT {
      @convfunction CMGetNext()
      @changed210 In CMPI 2.1, added the return code `CMPI_RC_NO_MORE_ELEMENTS`
          (which had been used by this function before).
+     @changed220 In CMPI 2.2, for streaming enumerations (see
+         @ref edt-enumeration "CMPIEnumeration Support"), this function may
+         also return the error return codes of the enumerating MB function
+         that created @p en.
     */
     CMPIData (*getNext) (const CMPIEnumeration* en, CMPIStatus* rc);
 
@@ -5076,6 +6783,12 @@ typedef struct _CMPIEnumerationFT {
      CMPIEnumerationFT.hasNext() tests for any elements left in a
      CMPIEnumeration object.
 
+     For streaming enumerations (see
+     @ref edt-enumeration "CMPIEnumeration Support"), this function may block
+     until the next page has been delivered by the target MI. If the target MI
+     reports an error instead of delivering the next page, this function
+     returns false, and the return status indicates that error.
+
      @param en Points to the CMPIEnumeration object for this function.
      @param [out] rc If not NULL, points to a CMPIStatus structure that upon
          return will have been updated with the function return status.
@@ -5095,6 +6808,10 @@ typedef struct _CMPIEnumerationFT {
      @convfunction CMHasNext()
      @changed210 In CMPI 2.1, added a requirement for the MB to return False
          if not successful.
+     @changed220 In CMPI 2.2, for streaming enumerations (see
+         @ref edt-enumeration "CMPIEnumeration Support"), this function may
+         block, and may also return the error return codes of the enumerating
+         MB function that created @p en.
     */
     CMPIBoolean (*hasNext) (const CMPIEnumeration* en, CMPIStatus* rc);
 
@@ -5125,6 +6842,11 @@ typedef struct _CMPIEnumerationFT {
      @li `CMPI_RC_OK` - Function successful.
      @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p en handle is invalid.
      @convfunction CMToArray()
+     @changed220 In CMPI 2.2, specified the behavior for streaming
+         enumerations (see @ref edt-enumeration "CMPIEnumeration Support"):
+         only the unconsumed elements of the current page are returned. The
+         function still succeeds if further pages remain; in that case,
+         CMPIEnumerationFT.hasNext() returns true afterwards.
     */
     CMPIArray* (*toArray) (const CMPIEnumeration* en, CMPIStatus* rc);
 
@@ -5205,6 +6927,17 @@ typedef struct _CMPIInstanceFT {
      CMPIInstanceFT.clone() creates an independent copy of a CMPIInstance
      object.
 
+     The copy is independent in that subsequent modifications of either
+     object, or the release of either object, do not affect the other
+     object. The MB may implement this by sharing the property storage
+     (including array values and embedded instances) between both objects,
+     and copying it only when one of the objects is modified for the first
+     time (copy-on-write). MIs that clone a cached instance and then set only
+     a few of its properties benefit from such an implementation. An MB that
+     shares property storage between CMPIInstance objects shall ensure that
+     the objects can be used by different threads as if they were fully
+     separate copies.
+
      @param inst Points to the CMPIInstance object that is to be copied.
      @param [out] rc If not NULL, points to a CMPIStatus structure that upon
          return will have been updated with the function return status.
@@ -5223,6 +6956,8 @@ typedef struct _CMPIInstanceFT {
      @li `CMPI_RC_OK` - Function successful.
      @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p inst handle is invalid.
      @convfunction CMClone()
+     @changed220 In CMPI 2.2, clarified that the MB may implement the copy
+         using copy-on-write.
     */
     CMPIInstance* (*clone) (const CMPIInstance* inst, CMPIStatus* rc);
 
@@ -5536,6 +7271,94 @@ typedef struct _CMPIInstanceFT {
 
 #endif /*CMPI_VER_200*/
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Get a property in a CMPIInstance object by property handle.
+
+     CMPIInstanceFT.getPropertyByHandle() gets a property in a CMPIInstance
+     object by property handle.
+
+     The result is the same as for CMPIInstanceFT.getProperty() with the
+     property name that was resolved to @p handle.
+
+     @param inst Points to the CMPIInstance object for this function.
+     @param handle Property handle, as returned by
+         CMPIBrokerEncFT.getPropertyHandle().
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a CMPIData structure containing the specified property
+         will be returned.
+
+         If not successful, CMPIData.state will be undefined.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p inst handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p handle is not a valid property
+         handle.
+     @li `CMPI_RC_ERR_NO_SUCH_PROPERTY` - Property not found.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMGetPropertyH()
+     @added220
+    */
+    CMPIData (*getPropertyByHandle) (const CMPIInstance* inst,
+        CMPIPropertyHandle handle, CMPIStatus* rc);
+
+    /**
+     @brief Add or replace a property value in a CMPIInstance object by
+         property handle.
+
+     CMPIInstanceFT.setPropertyByHandle() adds or replaces a property value in
+     a CMPIInstance object by property handle.
+
+     The effect is the same as for CMPIInstanceFT.setProperty() with the
+     property name that was resolved to @p handle, including the treatment of
+     key properties and of property filters set with
+     CMPIInstanceFT.setPropertyFilter().
+
+     @param inst Points to the CMPIInstance object for this function.
+     @param handle Property handle, as returned by
+         CMPIBrokerEncFT.getPropertyHandle().
+     @param value Points to a CMPIValue structure containing the non-NULL value
+         to be assigned to the property, or NULL to specify that NULL is to be
+         assigned.
+     @param type
+     @parblock
+         CMPIType value specifying the type of the value to be assigned to the
+         property.
+
+         All types of CIM values are supported.
+
+         If the value of @p type is @ref CMPI_chars or @ref CMPI_charsA, the
+         C-language string to which the chars member of @p value points is
+         copied by this function and the original string memory may be freed by
+         the MI right after this function returns.
+     @endparblock
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p inst handle is invalid.
+     @li `CMPI_RC_ERR_TYPE_MISMATCH` - @p type does not correspond to the
+         class-defined type.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p handle is not a valid property
+         handle.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMSetPropertyH()
+     @added220
+    */
+    CMPIStatus (*setPropertyByHandle) (const CMPIInstance* inst,
+        CMPIPropertyHandle handle, const CMPIValue* value, CMPIType type);
+
+#endif /*CMPI_VER_220*/
+
 } CMPIInstanceFT;
 
 /**
@@ -6193,22 +8016,190 @@ typedef struct _CMPIObjectPathFT {
          by the MB which will be released automatically by the MB (see
          Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard").
 
-         If not successful, NULL will be returned.
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p op handle is invalid.
+     @convfunction None. Use CDToString() instead.
+
+     @todo TBD AM: This function has no directly corresponding convenience
+         function, because it is pretty much a duplicate of
+         CMPIBrokerEncFT.toString() when used for CMPIObjectPath objects. So the
+         convenience function section recommends its convenience function,
+         CDToString(). Please review.
+    */
+    CMPIString* (*toString) (const CMPIObjectPath* op, CMPIStatus* rc);
+
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Get a hash value for the object path in a CMPIObjectPath object.
+
+     CMPIObjectPathFT.getHash() gets a hash value for the object path in a
+     CMPIObjectPath object, for use by MIs that index objects by their object
+     paths.
+
+     The hash value is calculated from a canonical form of the object path,
+     in which namespace, class name and key binding names are compared
+     case-insensitively, and the key bindings are in an order that does not
+     depend on the order in which they were added. Thus, object paths for
+     which CMPIObjectPathFT.equals() returns true have the same hash value.
+
+     The hash value is specific to the MB process and shall not be stored
+     persistently by the MI.
+
+     @param op Points to the CMPIObjectPath object for this function.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, the hash value will be returned.
+
+         If not successful, 0 will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p op handle is invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMGetObjectPathHash()
+     @added220
+    */
+    CMPIUint64 (*getHash) (const CMPIObjectPath* op, CMPIStatus* rc);
+
+    /**
+     @brief Test whether two CMPIObjectPath objects reference the same
+         object.
+
+     CMPIObjectPathFT.equals() tests whether the object paths in two
+     CMPIObjectPath objects reference the same object, following the rules
+     for comparing object paths defined in @ref ref-dmtf-dsp0004 "DSP0004":
+     @li Namespace and class name are compared case-insensitively.
+     @li The key bindings are compared regardless of their order. Key binding
+         names are compared case-insensitively, and key values of string
+         type are compared case-sensitively. Key values that are references
+         are compared using these rules recursively.
+     @li The host name is not compared.
+
+     @param op1 Points to the CMPIObjectPath object for this function.
+     @param op2 Points to the CMPIObjectPath object that is compared with
+         @p op1.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a @ref CMPIBoolean value indicating the test result
+         will be returned, as follows:
+         @li True indicates that both object paths reference the same object;
+         @li False indicates that this is not the case.
+
+         If not successful, false will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p op1 or @p op2 handle is
+         invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMObjectPathEquals()
+     @added220
+    */
+    CMPIBoolean (*equals) (const CMPIObjectPath* op1,
+        const CMPIObjectPath* op2, CMPIStatus* rc);
+
+    /**
+     @brief Convert the object path in a CMPIObjectPath object into its
+         canonical binary representation.
+
+     CMPIObjectPathFT.toBinary() converts the object path in a CMPIObjectPath
+     object into a compact, canonical binary representation. It can be
+     converted back into a CMPIObjectPath object using
+     CMPIBrokerEncFT.newObjectPathFromBinary(), without formatting and
+     parsing a string representation.
+
+     The binary representation is canonical: Object paths for which
+     CMPIObjectPathFT.equals() returns true have byte-wise identical binary
+     representations, and object paths for which it returns false have
+     different binary representations. Thus, the binary representation can
+     be used as a key in maps that compare keys byte-wise. For that, the MB
+     omits the host name, represents namespace, class name and key binding
+     names in a case-normalized form, and orders the key bindings by name.
+
+     The binary representation is MB implementation-specific, and remains
+     valid at least for the lifetime of the MB process. It does not contain
+     any pointers.
+
+     If @p buf is NULL or @p bufSize is less than the size of the binary
+     representation, nothing is stored, and the required size is returned.
+
+     @param op Points to the CMPIObjectPath object for this function.
+     @param [out] buf If not NULL, points to a buffer that upon success will
+         have been updated with the binary representation.
+     @param bufSize Size of @p buf in Bytes.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, the size of the binary representation in Bytes will
+         be returned. If that size is greater than @p bufSize, nothing has
+         been stored in @p buf.
+
+         If not successful, 0 will be returned.
      @endparblock
      @errors
      The function return status will indicate one of the following @ref CMPIrc
      codes:
      @li `CMPI_RC_OK` - Function successful.
      @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p op handle is invalid.
-     @convfunction None. Use CDToString() instead.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMObjectPathToBinary()
+     @added220
+    */
+    size_t (*toBinary) (const CMPIObjectPath* op, void* buf, size_t bufSize,
+        CMPIStatus* rc);
 
-     @todo TBD AM: This function has no directly corresponding convenience
-         function, because it is pretty much a duplicate of
-         CMPIBrokerEncFT.toString() when used for CMPIObjectPath objects. So the
-         convenience function section recommends its convenience function,
-         CDToString(). Please review.
+    /**
+     @brief Add or replace multiple key bindings in a CMPIObjectPath object.
+
+     CMPIObjectPathFT.addKeys() adds or replaces multiple key bindings in a
+     CMPIObjectPath object by name. The result is the same as calling
+     CMPIObjectPathFT.addKey() for each of the key bindings in array order,
+     but allows the MB to set up its internal storage for all key bindings at
+     once.
+
+     @param op Points to the CMPIObjectPath object for this function.
+     @param names Points to an array of @p n key binding names.
+     @param values Points to an array of @p n CMPIValue structures containing
+         the values to be assigned to the key bindings. Key bindings are not
+         permitted to be NULL.
+     @param types Points to an array of @p n types of the values to be
+         assigned to the key bindings, with the same requirements as for
+         CMPIObjectPathFT.addKey(). C-language strings referenced by values of
+         type @ref CMPI_chars are copied by this function.
+     @param n Number of key bindings, i.e. number of entries in the
+         @p names, @p values and @p types arrays.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p op handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - One of the names or values is
+         invalid. No key bindings have been added or replaced in this case.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMAddKeys()
+     @added220
     */
-    CMPIString* (*toString) (const CMPIObjectPath* op, CMPIStatus* rc);
+    CMPIStatus (*addKeys) (const CMPIObjectPath* op, const char** names,
+        const CMPIValue* values, const CMPIType* types, CMPICount n);
+
+#endif /*CMPI_VER_220*/
 
 } CMPIObjectPathFT;
 
@@ -6910,6 +8901,51 @@ typedef struct _CMPISelectExpFT {
     CMPIBoolean (*evaluateUsingAccessor) (const CMPISelectExp* se,
         CMPIAccessor* accessor, void* parm, CMPIStatus* rc);
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Test whether each instance in an array of instances matches the
+         select expression in a CMPISelectExp object.
+
+     CMPISelectExpFT.evaluateBatch() tests whether each instance in an array of
+     instances matches the select expression in a CMPISelectExp object. The
+     result is the same as calling CMPISelectExpFT.evaluate() for each of the
+     instances.
+
+     This function allows the MB to translate the select expression into an
+     internal form that is suitable for repeated evaluation (for example, a
+     flat program derived from the predicates of the select expression) once,
+     and to apply it to all instances. The MB may retain that internal form
+     in @p se for use by subsequent calls with the same @p se.
+
+     @param se Points to the CMPISelectExp object for this function.
+     @param insts Points to an array of @p n pointers to CMPIInstance objects
+         containing the instances to be tested.
+     @param n Number of entries in the @p insts and @p out arrays.
+     @param [out] out Points to an array of @p n @ref CMPIBoolean values that
+         upon success will have been updated with the test results. Entry `i`
+         is true if `insts[i]` matches the select expression, and false
+         otherwise.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p se handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p insts or @p out is NULL, or one
+         of the instances is invalid. The content of @p out is undefined in
+         this case.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMEvaluateSelExpBatch()
+     @capquerynorm
+     @added220
+    */
+    CMPIStatus (*evaluateBatch) (const CMPISelectExp* se,
+        const CMPIInstance* const* insts, CMPICount n, CMPIBoolean* out);
+
+#endif /*CMPI_VER_220*/
+
 } CMPISelectExpFT;
 
 /**
@@ -8772,9 +10808,16 @@ typedef struct _CMPIPropertyListFT {
      CMPIPropertyListFT.isPropertyInList() tests whether a property is in
      the property list represented by a CMPIPropertyList object.
 
-     The MB's implementation of this function should be efficient. However,
-     it is recommended that MIs when returning many instances invoke this
-     function only once for each property, and cache the result.
+     The property name is matched case-insensitively.
+
+     The MB's implementation of this function should be efficient. Since
+     CMPI 2.2, the time needed by this function should not depend on the
+     number of property names in the list (e.g. by using a hash set of
+     case-folded property names that is built when the CMPIPropertyList
+     object is created; see CMPIBrokerEncFT.newPropertyList()). However, it
+     is recommended that MIs when returning many instances invoke this
+     function only once for each property, and cache the result, or use
+     CMPIPropertyListFT.isPropertyHandleInList().
 
      @param plist Points to the CMPIPropertyList object for this function.
      @param pname Name of the property to be tested.
@@ -8796,6 +10839,8 @@ typedef struct _CMPIPropertyListFT {
      @li `CMPI_RC_ERR_INVALID_PARAMETER` - The @p pname value is invalid.
      @convfunction CMIsPropertyInList()
      @added210
+     @changed220 In CMPI 2.2, recommended that the time needed by this
+         function does not depend on the length of the property list.
     */
     CMPIBoolean (*isPropertyInList) (const CMPIPropertyList* plist,
         const char* pname, CMPIStatus* rc);
@@ -8819,14 +10864,18 @@ typedef struct _CMPIPropertyListFT {
 
          The entries in that array may be in any order and in any lexical case
          (possibly different than originally specified in
-         CMPIBrokerEncFT.newPropertyList()).
+         CMPIBrokerEncFT.newPropertyList()). Since CMPI 2.2, the entries
+         should be the case-folded property names the MB uses for lookups.
 
          The returned array shall not be explicitly released by the MI, because
          it may point to an internal data area in the CMPIPropertyList object
          which will be released along with that object, or it may point to a
          new array created by the MB which will be released automatically by
          the MB (see Subclause 4.1.7 of the
-         @ref ref-cmpi-standard "CMPI Standard").
+         @ref ref-cmpi-standard "CMPI Standard"). Since CMPI 2.2, the MB
+         should return an internal data area, so that this function does not
+         allocate memory; the MI shall not modify the returned array or the
+         strings it points to.
 
          If not successful, NULL will be returned.
      @endparblock
@@ -8837,10 +10886,64 @@ typedef struct _CMPIPropertyListFT {
      @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p plist handle is invalid.
      @convfunction CMGetListProperties()
      @added210
+     @changed220 In CMPI 2.2, recommended that the MB returns the
+         case-folded property names in an internal data area.
     */
     const char** (*getProperties) (const CMPIPropertyList* plist,
         CMPIStatus* rc);
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Test whether a property identified by a property handle is in the
+         property list represented by a CMPIPropertyList object.
+
+     CMPIPropertyListFT.isPropertyHandleInList() tests whether the property
+     identified by a property handle is in the property list represented by a
+     CMPIPropertyList object.
+
+     The result is the same as calling CMPIPropertyListFT.isPropertyInList()
+     with the name of the property for which the property handle was
+     resolved. Because the MB has already resolved the property name when
+     creating the property handle, it can implement this test without
+     comparing property names (e.g. by looking up the handle in a set that is
+     built once, when the CMPIPropertyList object is created).
+
+     This allows MIs to test cheaply, before computing the value of a
+     property, whether that property has been requested at all; this is
+     useful for properties whose values are expensive to obtain.
+
+     @param plist Points to the CMPIPropertyList object for this function.
+     @param handle Property handle of the property to be tested, as returned
+         by CMPIBrokerEncFT.getPropertyHandle().
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return has been updated with the function return status
+     @return @parblock
+         If successful, a @ref CMPIBoolean value indicating the test result
+         will be returned, as follows:
+         @li True indicates that the property is in the property list;
+         @li False indicates that this is not the case.
+
+         If not successful, True will be returned, so that an MI using the
+         result to skip the computation of properties does not omit a
+         property that may have been requested.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p plist handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - The @p handle value is invalid.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @convfunction CMIsPropertyHandleInList()
+     @added220
+    */
+    CMPIBoolean (*isPropertyHandleInList) (const CMPIPropertyList* plist,
+        CMPIPropertyHandle handle, CMPIStatus* rc);
+
+#endif /*CMPI_VER_220*/
+
 } CMPIPropertyListFT;
 
 #endif /*CMPI_VER_210*/
@@ -8957,6 +11060,10 @@ typedef struct _CMPIEnumerationFilterFT {
 
      The MB's implementation of this function should be efficient.
 
+     Since CMPI 2.2, this function does not modify @p ef, and it may be called
+     concurrently by multiple threads for the same CMPIEnumerationFilter
+     object.
+
      @param ef Points to the CMPIEnumerationFilter object for this function.
      @param inst Points to the CMPIInstance object to be tested against the
          filter.
@@ -8982,6 +11089,8 @@ typedef struct _CMPIEnumerationFilterFT {
      @li `CMPI_RC_ERR_FAILED` - Other error occurred.
      @convfunction CMFilterMatch()
      @added210
+     @changed220 In CMPI 2.2, specified that concurrent calls for the same
+         CMPIEnumerationFilter object are supported.
      @bug The @ref ref-cmpi-standard "CMPI Standard" misses to define when a
          filter matches. This should be added, by using the definition from the
          header file.
@@ -8989,10 +11098,270 @@ typedef struct _CMPIEnumerationFilterFT {
     CMPIBoolean (*match) (const CMPIEnumerationFilter* ef,
         const CMPIInstance* inst, CMPIStatus* rc);
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Test whether each instance in an array of instances matches the
+         filter represented by a CMPIEnumerationFilter object.
+
+     CMPIEnumerationFilterFT.matchBatch() tests whether each instance in an
+     array of instances matches the filter represented by a
+     CMPIEnumerationFilter object. The result is the same as calling
+     CMPIEnumerationFilterFT.match() for each of the instances.
+
+     This function allows the MB to perform its per-call processing once for
+     all instances. Like CMPIEnumerationFilterFT.match(), it does not modify
+     @p ef, and it may be called concurrently by multiple threads for the
+     same CMPIEnumerationFilter object.
+
+     @param ef Points to the CMPIEnumerationFilter object for this function.
+     @param insts Points to an array of @p n pointers to CMPIInstance objects
+         containing the instances to be tested.
+     @param n Number of entries in the @p insts and @p out arrays.
+     @param [out] out Points to an array of @p n @ref CMPIBoolean values that
+         upon success will have been updated with the test results. Entry `i`
+         is true if `insts[i]` matches the filter, and false otherwise.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p ef handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p insts or @p out is NULL, or one
+         of the instances is invalid. The content of @p out is undefined in
+         this case.
+     @li `CMPI_RC_ERR_QUERY_FEATURE_NOT_SUPPORTED` - A feature of
+         the query language is not supported.
+     @li `CMPI_RC_ERR_NOT_SUPPORTED` - This function is not supported by this
+         MB.
+     @li `CMPI_RC_ERR_FAILED` - Other error occurred.
+     @convfunction CMFilterMatchBatch()
+     @added220
+    */
+    CMPIStatus (*matchBatch) (const CMPIEnumerationFilter* ef,
+        const CMPIInstance* const* insts, CMPICount n, CMPIBoolean* out);
+
+#endif /*CMPI_VER_220*/
+
 } CMPIEnumerationFilterFT;
 
 #endif /*CMPI_VER_210*/
 
+#ifdef CMPI_VER_220
+
+/**
+ * @}
+ * @addtogroup edt-filterset
+ * @{
+ */
+
+/**
+ * @brief CMPIFilterSet encapsulated data type object.
+ *
+ * CMPIFilterSet provides indication MIs with an efficient way to test an
+ * instance against a large number of select expressions, such as the
+ * indication filters that have been activated using
+ * CMPIIndicationMIFT.activateFilter().
+ *
+ * Each select expression in a filter set is identified by a filter id chosen
+ * by the MI. The MB merges the predicates of all select expressions in the
+ * filter set into shared index structures (e.g. keyed by the property and
+ * value of predicates using @ref CMPI_PredOp_Equals, or by value ranges for
+ * predicates using @ref CMPI_PredOp_LessThan and the like), so that the
+ * effort for CMPIFilterSetFT.match() grows less than linearly with the
+ * number of select expressions.
+ *
+ * CMPIFilterSetFT.match() does not modify the filter set, and may be called
+ * concurrently by multiple threads for the same CMPIFilterSet object.
+ * CMPIFilterSetFT.addFilter(), CMPIFilterSetFT.removeFilter() and
+ * CMPIFilterSetFT.release() modify the filter set; the MI shall ensure that
+ * no other function is called for the same CMPIFilterSet object while one of
+ * them is executing (e.g. by using a reader-writer lock, see
+ * CMPIBrokerExtFT.newRWLock()).
+ *
+ * @capquerynorm
+ * @added220
+ */
+typedef struct _CMPIFilterSet {
+
+    /**
+     * @brief Opaque pointer to MB-specific implementation data for this object.
+     */
+    const void* hdl;
+
+    /**
+     * @brief Pointer to the function table for this object.
+     */
+    const CMPIFilterSetFT* ft;
+
+} CMPIFilterSet;
+
+/**
+ * @brief Function table of CMPIFilterSet encapsulated data type object.
+ *
+ * @added220
+ */
+typedef struct _CMPIFilterSetFT {
+
+    /**
+     * @brief CMPI version supported by the MB for this function table.
+     *
+     * Any earlier CMPI versions are implicitly also supported.
+     *
+     * See @ref sym-version-nnn "CMPIVersion\<NNN\>" for valid CMPI
+     * version numbers.
+     */
+    CMPIVersion ftVersion;
+
+    /**
+     @brief Release a CMPIFilterSet object.
+
+     CMPIFilterSetFT.release() releases a CMPIFilterSet object. This
+     indicates to the MB that the object (including any objects it contains)
+     will no longer be used by the MI. The MB may free (=reclaim) the memory
+     associated with the object during the call to this function, or later
+     during some garbage collection cycle (see Subclause 4.1.7 of the
+     @ref ref-cmpi-standard "CMPI Standard").
+
+     @param fs Points to the CMPIFilterSet object that is to be released.
+         That object shall have been created using CMPIFilterSetFT.clone().
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p fs handle is invalid.
+     @convfunction CMRelease()
+     @added220
+    */
+    CMPIStatus (*release) (CMPIFilterSet* fs);
+
+    /**
+     @brief Create an independent copy of a CMPIFilterSet object.
+
+     CMPIFilterSetFT.clone() creates an independent copy of a CMPIFilterSet
+     object, including the filters it contains.
+
+     @param fs Points to the CMPIFilterSet object that is to be copied.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to the copied CMPIFilterSet object will be
+         returned.
+
+         The returned CMPIFilterSet object shall be explicitly released by the
+         MI using CMPIFilterSetFT.release().
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p fs handle is invalid.
+     @convfunction CMClone()
+     @added220
+    */
+    CMPIFilterSet* (*clone) (const CMPIFilterSet* fs, CMPIStatus* rc);
+
+    /**
+     @brief Add a select expression to a CMPIFilterSet object.
+
+     CMPIFilterSetFT.addFilter() adds a select expression to a CMPIFilterSet
+     object, identified by a filter id.
+
+     The MB uses the select expression only during this call, so the MI may
+     release @p se afterwards. This allows the MI to add the select expression
+     passed to CMPIIndicationMIFT.activateFilter() directly.
+
+     @param fs Points to the CMPIFilterSet object for this function.
+     @param se Points to a CMPISelectExp object containing the select
+         expression to be added.
+     @param id Filter id that identifies the select expression in @p fs.
+         It is returned by CMPIFilterSetFT.match() when the select expression
+         matches.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p fs or @p se handle is
+         invalid.
+     @li `CMPI_RC_ERR_ALREADY_EXISTS` - @p fs already contains a select
+         expression with filter id @p id.
+     @li `CMPI_RC_ERR_QUERY_FEATURE_NOT_SUPPORTED` - A feature of the query
+         language used in @p se is not supported.
+     @convfunction CMAddFilter()
+     @added220
+    */
+    CMPIStatus (*addFilter) (const CMPIFilterSet* fs, const CMPISelectExp* se,
+        CMPIUint32 id);
+
+    /**
+     @brief Remove a select expression from a CMPIFilterSet object.
+
+     CMPIFilterSetFT.removeFilter() removes the select expression with the
+     specified filter id from a CMPIFilterSet object.
+
+     @param fs Points to the CMPIFilterSet object for this function.
+     @param id Filter id of the select expression to be removed.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p fs handle is invalid.
+     @li `CMPI_RC_ERR_NOT_FOUND` - @p fs does not contain a select
+         expression with filter id @p id.
+     @convfunction CMRemoveFilter()
+     @added220
+    */
+    CMPIStatus (*removeFilter) (const CMPIFilterSet* fs, CMPIUint32 id);
+
+    /**
+     @brief Determine the select expressions in a CMPIFilterSet object that
+         an instance matches.
+
+     CMPIFilterSetFT.match() tests an instance against all select expressions
+     in a CMPIFilterSet object, and returns the filter ids of the select
+     expressions that the instance matches. For each select expression, the
+     result is the same as for CMPISelectExpFT.evaluate().
+
+     @param fs Points to the CMPIFilterSet object for this function.
+     @param inst Points to a CMPIInstance object containing the instance to be
+         tested.
+     @param [out] rc If not NULL, points to a CMPIStatus structure that upon
+         return will have been updated with the function return status.
+     @return @parblock
+         If successful, a pointer to a CMPIArray object with elements of type
+         @ref CMPI_uint32 will be returned, containing the filter ids of the
+         matching select expressions in no particular order. If no select
+         expression matches, the array is empty.
+
+         The returned CMPIArray object is a new object for each call, and is
+         not affected by subsequent calls for @p fs, or by changes to @p fs.
+         It will be automatically released by the MB, as described in
+         Subclause 4.1.7 of the @ref ref-cmpi-standard "CMPI Standard".
+         There is no function to explicitly release the new object.
+
+         If not successful, NULL will be returned.
+     @endparblock
+     @errors
+     The function return status will indicate one of the following @ref CMPIrc
+     codes:
+     @li `CMPI_RC_OK` - Function successful.
+     @li `CMPI_RC_ERR_INVALID_HANDLE` - The @p fs handle is invalid.
+     @li `CMPI_RC_ERR_INVALID_PARAMETER` - @p inst is invalid.
+     @convfunction CMFilterSetMatch()
+     @added220
+    */
+    CMPIArray* (*match) (const CMPIFilterSet* fs, const CMPIInstance* inst,
+        CMPIStatus* rc);
+
+} CMPIFilterSetFT;
+
+#endif /*CMPI_VER_220*/
+
 /**
  * @}
  * @addtogroup instance-mi
@@ -9669,6 +12038,115 @@ typedef struct _CMPIInstanceMIFT {
 
 #endif /*CMPI_VER_210*/
 
+#ifdef CMPI_VER_220
+
+    /**
+     @brief Enumerate one page of the instances of a given class that are
+         serviced by this MI.
+
+     CMPIInstanceMIFT.enumerateInstancesPaged() shall enumerate at most
+     @p maxObjects instances of a given class that are serviced by this MI,
+     starting at the position identified by @p continuation, by accessing the
+     underlying managed elements.
+
+     The MB calls this function repeatedly in order to retrieve the result set
+     of an enumeration in pages. The first call of an enumeration passes NULL
+     for @p continuation. Each subsequent call passes the continuation token
+     that was returned by the previous call in @p nextContinuation. The format
+     and content of the continuation token is defined by the MI and is opaque
+     to the MB; typically, it encodes the position of an MI-internal cursor
+     into the underlying managed elements. The MI shall not rely on the
+     enumeration being continued: the MB may abandon an enumeration at any
+     time, for example because the client has closed the enumeration or has
+     received all instances it was interested in.
+
+     The same considerations regarding the class of @p classPath apply as
+     for CMPIInstanceMIFT.enumerateInstances().
+
+     Support for this function is optional for MIs. The MB shall call this
+     function only if the @p miVersion member of the MI function table is at
+     least 220 and this function table entry is not NULL. Otherwise, or if
+     this function returns `CMPI_RC_ERR_NOT_SUPPORTED` on the first call of an
+     enumeration, the MB shall perform the enumeration by calling
+     CMPIInstanceMIFT.enumerateInstances() instead. MIs using
+     CMInstanceMIStub() set this entry to NULL unless they opt in (see
+     CMInstanceMIStub()).
+
+     @param mi Points to a CMPIInstanceMI structure.
+     @param ctx Points to a CMPIContext object containing the context data
+         for the invocation.
+     @param rslt Points to a CMPIResult object that is the result data
+         container. Upon successful return, the MI shall have put the
+         instances of this page of the result set into this container.
+     @param classPath Points to a CMPIObjectPath object that references the
+         given class and that contains the namespace and class name components.
+         The hostname and key components, if present, have no meaning and
+         should be ignored.
+     @param properties If not NULL, is an array of zero or more pointers to
+         strings, each specifying a property name. This set of property names
+         will reflect the effects of any invocation flags specified in the
+         @ref CMPIInvocationFlags entry of @p ctx. The end of the array
+         is identified by a NULL pointer. Each returned object shall not
+         include elements for any properties missing from this list. If the
+         properties argument is NULL, this indicates that all properties shall
+         be included in each returned object. The MB shall pass the same
+         property list in all calls of an enumeration.
+     @param continuation If not NULL, points to a CMPIString object containing
+         the continuation token returned by the previous call of this
+         enumeration. NULL indicates the first call of an enumeration. The
+         object is owned by the MB and is valid only during this call; the MI
+         shall not release it, and shall copy its content if needed later.
+     @param maxObjects Maximum number of instances the MI shall put into
+         @p rslt in this call. The MB shall not pass 0.
+     @param [out] nextContinuation Points to a CMPIString pointer that upon
+         successful return shall have been set by the MI. If the result set
+         has been exhausted, it shall be set to NULL. Otherwise, it shall be
+         set to a new CMPIString object containing the continuation token to
+         be passed in the next call of this enumeration, created by the MI
+         using CMPIBrokerEncFT.newString(). Like any object created by the MI
+         this way, that object will be automatically released by the MB when
+         this function returns, and shall not be released by the MI. The MB
+         retains a copy of the continuation token (e.g. using
+         CMPIStringFT.clone()) for the next call, and releases that copy when
+         the enumeration ends or is abandoned. Returning fewer than
+         @p maxObjects instances does not by itself indicate the end of the
+         result set.
+     @return CMPIStatus structure containing the function return status.
+     @errors
+     The following table lists the @ref CMPIrc codes that shall be used by the
+     MI in the function return status, as well as the WBEM operation messages
+     that should be used in the CMPIError object if the MI supports
+     extended error handling (see the corresponding
+     @ref cap-errors "Extended Errors" capability):
+     <TABLE>
+     <TR><TH>CMPIRCCode</TH><TH>CMPIErrorMsg</TH><TH>Description</TH></TR>
+     <TR><TD>`CMPI_RC_OK`</TD><TD>N/A</TD>
+         <TD>Function Successful.</TD></TR>
+     <TR><TD>`CMPI_RC_ERR_NOT_SUPPORTED`</TD><TD>WIPG0228</TD>
+         <TD>Function is not supported by the MI.</TD></TR>
+     <TR><TD>`CMPI_RC_ERR_ACCESS_DENIED`</TD><TD>WIPG0201</TD>
+         <TD>Not authorized.</TD></TR>
+     <TR><TD>`CMPI_RC_ERR_INVALID_PARAMETER`</TD><TD>N/A</TD>
+         <TD>The @p continuation token is invalid or has expired.</TD></TR>
+     <TR><TD>`CMPI_RC_ERR_SERVER_LIMITS_EXCEEDED`</TD><TD>WIPG0240</TD>
+         <TD>Limits exceeded.</TD></TR>
+     <TR><TD>`CMPI_RC_ERR_FAILED`</TD><TD>WIPG0243</TD>
+         <TD>Timeout occurred.</TD></TR>
+     <TR><TD>`CMPI_RC_ERR_FAILED`</TD><TD>WIPG0227 + implementation-specific
+         message</TD>
+         <TD>Other error occurred.</TD></TR>
+     </TABLE>
+     @convfunction CMInstanceMIStub()
+     @added220
+    */
+    CMPIStatus (*enumerateInstancesPaged) (CMPIInstanceMI* mi,
+        const CMPIContext* ctx, const CMPIResult* rslt,
+        const CMPIObjectPath* classPath, const char** properties,
+        const CMPIString* continuation, CMPICount maxObjects,
+        CMPIString** nextContinuation);
+
+#endif /*CMPI_VER_220*/
+
 } CMPIInstanceMIFT;
 
 /**
@@ -11264,6 +13742,11 @@ typedef struct _CMPIIndicationMIFT {
      during the first activation of the filter. For the concept of coverage of
      indications by an indication filter, see @ref ref-dmtf-dsp1054 "DSP1054".
 
+     MIs that need to test indications against many active filters can add
+     @p filter to a @ref CMPIFilterSet object (see
+     CMPIBrokerEncFT.newFilterSet()) upon its first activation, and remove it
+     upon its last deactivation in CMPIIndicationMIFT.deActivateFilter().
+
      @param mi Points to a CMPIIndicationMI structure.
      @param ctx Points to a CMPIContext object containing the context data for
          the invocation. If the filter is activated because a client creates a
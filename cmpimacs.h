@@ -632,7 +632,8 @@ static inline CMPIBoolean CMIsArray(
         CMPIPredicateFT.release(),
         CMPIErrorFT.release(),
         CMPIPropertyListFT.release(),
-        CMPIEnumerationFilterFT.release()
+        CMPIEnumerationFilterFT.release(),
+        CMPIFilterSetFT.release()
     @examples
     Code to clean up after attempting to create an instance:
     @code (.c)
@@ -682,7 +683,8 @@ static inline CMPIBoolean CMIsArray(
         CMPIPredicateFT.clone(),
         CMPIErrorFT.clone(),
         CMPIPropertyListFT.clone(),
-        CMPIEnumerationFilterFT.clone()
+        CMPIEnumerationFilterFT.clone(),
+        CMPIFilterSetFT.clone()
     @examples
     Clone an instance to add to an array:
     @code (.c)
@@ -928,6 +930,120 @@ static inline CMPIStatus CMReturnError(
 #endif
 #endif /* CMPI_VER_200 */
 
+#ifdef CMPI_VER_220
+/** @brief Add an array of instances to a CMPIResult object.
+
+    @param rslt CMPIResult object.
+    @param insts Array of instances to be returned.
+    @param n Number of entries in @p insts.
+    @return Function return status.
+    @fulldescription CMPIResultFT.returnInstances()
+    @examples
+    The following code fragment returns instances in batches of 256:
+    @code (.c)
+    const CMPIInstance *batch[256];
+    CMPICount n = 0;
+    CMPIStatus st = { CMPI_RC_OK, NULL };
+
+    while (st.rc == CMPI_RC_OK && . . .) {
+        batch[n++] = CMNewInstance(_broker, . . .);
+        if (n == 256) {
+            st = CMReturnInstances(rslt, batch, n);   // one call per batch
+            while (n > 0)
+                CMRelease((CMPIInstance *)batch[--n]);
+        }
+    }
+    if (st.rc == CMPI_RC_OK && n > 0)
+        st = CMReturnInstances(rslt, batch, n);
+    while (n > 0)
+        CMRelease((CMPIInstance *)batch[--n]);
+    @endcode
+    @capbatchresults
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMReturnInstances(rslt, insts, n) \
+    ((rslt)->ft->returnInstances((rslt), (insts), (n)))
+#else
+static inline CMPIStatus CMReturnInstances(
+    const CMPIResult *rslt,
+    const CMPIInstance *const *insts,
+    CMPICount n)
+{
+    return rslt->ft->returnInstances(rslt, insts, n);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Add an array of object paths to a CMPIResult object.
+
+    @param rslt CMPIResult object.
+    @param ops Array of object paths to be returned.
+    @param n Number of entries in @p ops.
+    @return Function return status.
+    @fulldescription CMPIResultFT.returnObjectPaths()
+    @examples See CMReturnInstances()
+    @capbatchresults
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMReturnObjectPaths(rslt, ops, n) \
+    ((rslt)->ft->returnObjectPaths((rslt), (ops), (n)))
+#else
+static inline CMPIStatus CMReturnObjectPaths(
+    const CMPIResult *rslt,
+    const CMPIObjectPath *const *ops,
+    CMPICount n)
+{
+    return rslt->ft->returnObjectPaths(rslt, ops, n);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Test whether the MB needs further results in a CMPIResult object.
+
+    @param rslt CMPIResult object.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Boolean indicating whether the MB does not need further results.
+    @fulldescription CMPIResultFT.isCancelled()
+    @examples
+    The following code fragment stops enumerating a large set of log records
+    when the client is no longer interested in them:
+    @code (.c)
+    while (. . .) {
+        if (CMIsCancelled(rslt, NULL))
+            break;              // leave without calling CMReturnDone()
+        inst = CMNewInstance(_broker, . . .);
+        . . .
+        st = CMReturnInstance(rslt, inst);
+        CMRelease(inst);
+        if (st.rc == CMPI_RC_ERR_ABORTED)
+            break;
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMIsCancelled(rslt, rc) \
+    ((rslt)->ft->isCancelled((rslt), (rc)))
+#else
+static inline CMPIBoolean CMIsCancelled(
+    const CMPIResult *rslt,
+    CMPIStatus *rc)
+{
+    return rslt->ft->isCancelled(rslt, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 
 /**
   @}
@@ -1137,6 +1253,115 @@ static inline CMPIStatus CMSetArrayElementAt(
 }
 #endif
 
+#ifdef CMPI_VER_220
+/** @brief Get the values of a range of array elements in a CMPIArray object
+        into a buffer.
+
+    @param ar CMPIArray object.
+    @param start Zero-based position of the first array element.
+    @param count Number of array elements.
+    @param [out] buf Buffer for @p count native C values of the simple base
+        type of the array.
+    @return Function return status.
+    @fulldescription CMPIArrayFT.getElements()
+    @examples
+    The following code fragment copies the values of an array property of type
+    `uint16[]` into a C array:
+    @code (.c)
+    CMPIUint16 *codes;
+    CMPICount n;
+    CMPIData data = CMGetProperty(inst, "OperationalStatus", &rc);
+
+    if (rc.rc == CMPI_RC_OK && data.type == CMPI_uint16A &&
+        !(data.state & CMPI_nullValue)) {
+        n = CMGetArrayCount(data.value.array, NULL);
+        codes = malloc(n * sizeof(CMPIUint16));
+        rc = CMGetArrayElements(data.value.array, 0, n, codes); // one call
+        . . .
+        free(codes);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMGetArrayElements(ar, start, count, buf) \
+    ((ar)->ft->getElements((ar), (start), (count), (buf)))
+#else
+static inline CMPIStatus CMGetArrayElements(
+    const CMPIArray *ar,
+    CMPICount start,
+    CMPICount count,
+    void *buf)
+{
+    return ar->ft->getElements(ar, start, count, buf);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Set the values of a range of existing array elements in a
+        CMPIArray object from a buffer.
+
+    @param ar CMPIArray object.
+    @param start Zero-based position of the first array element.
+    @param count Number of array elements.
+    @param buf Buffer with @p count native C values of the simple base type
+        of the array.
+    @return Function return status.
+    @fulldescription CMPIArrayFT.setElements()
+    @examples
+    @code (.c)
+    CMPIUint64 counters[1024];
+    CMPIArray *ar = CMNewArray(_broker, 1024, CMPI_uint64, &rc);
+
+    read_counters(counters, 1024);
+    rc = CMSetArrayElements(ar, 0, 1024, counters);   // one call, not 1024
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMSetArrayElements(ar, start, count, buf) \
+    ((ar)->ft->setElements((ar), (start), (count), (buf)))
+#else
+static inline CMPIStatus CMSetArrayElements(
+    const CMPIArray *ar,
+    CMPICount start,
+    CMPICount count,
+    const void *buf)
+{
+    return ar->ft->setElements(ar, start, count, buf);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Get read-only access to the internal buffer of a CMPIArray object.
+
+    @param ar CMPIArray object.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Internal buffer of the array, or NULL if not available.
+    @fulldescription CMPIArrayFT.getRawBuffer()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMGetArrayRawBuffer(ar, rc) \
+    ((ar)->ft->getRawBuffer((ar), (rc)))
+#else
+static inline const void *CMGetArrayRawBuffer(
+    const CMPIArray *ar,
+    CMPIStatus *rc)
+{
+    return ar->ft->getRawBuffer(ar, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 
 /**
   @}
@@ -1428,6 +1653,64 @@ static inline CMPIStatus CMSetPropertyWithOrigin(
 #endif
 #endif /* CMPI_VER_200 */
 
+#ifdef CMPI_VER_220
+/** @brief Get a property in a CMPIInstance object by property handle.
+
+    @param inst CMPIInstance object.
+    @param handle Property handle, as returned by CMGetPropertyHandle().
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Property value and type.
+    @fulldescription CMPIInstanceFT.getPropertyByHandle()
+    @examples See CMGetPropertyHandle()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMGetPropertyH(inst, handle, rc) \
+    ((inst)->ft->getPropertyByHandle((inst), (handle), (rc)))
+#else
+static inline CMPIData CMGetPropertyH(
+    const CMPIInstance *inst,
+    CMPIPropertyHandle handle,
+    CMPIStatus *rc)
+{
+    return inst->ft->getPropertyByHandle(inst, handle, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Add or replace a property value in a CMPIInstance object by
+        property handle.
+
+    @param inst CMPIInstance object.
+    @param handle Property handle, as returned by CMGetPropertyHandle().
+    @param value CMPIValue structure containing the non-NULL value to be
+        assigned to the element, or NULL to assign NULL.
+    @param type Type of the value.
+    @return Function return status.
+    @fulldescription CMPIInstanceFT.setPropertyByHandle()
+    @examples See CMGetPropertyHandle()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMSetPropertyH(inst, handle, value, type) \
+    ((inst)->ft->setPropertyByHandle((inst), (handle), (value), (type)))
+#else
+static inline CMPIStatus CMSetPropertyH(
+    const CMPIInstance *inst,
+    CMPIPropertyHandle handle,
+    const CMPIValue *value,
+    CMPIType type)
+{
+    return inst->ft->setPropertyByHandle(inst, handle, value, type);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 
 /**
   @}
@@ -1802,6 +2085,140 @@ static inline CMPIData CMGetParameterQualifier(
 }
 #endif
 
+#ifdef CMPI_VER_220
+/** @brief Get a hash value for the object path in a CMPIObjectPath object.
+
+    @param op CMPIObjectPath object.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Hash value of the object path.
+    @fulldescription CMPIObjectPathFT.getHash()
+    @examples
+    @code (.c)
+    static struct device *find_device(const CMPIObjectPath *op)
+    {
+        CMPIUint64 hash = CMGetObjectPathHash(op, NULL);
+        struct device *dev;
+
+        for (dev = buckets[hash % NBUCKETS]; dev; dev = dev->next) {
+            if (dev->hash == hash && CMObjectPathEquals(dev->op, op, NULL))
+                return dev;
+        }
+        return NULL;
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMGetObjectPathHash(op, rc) \
+    ((op)->ft->getHash((op), (rc)))
+#else
+static inline CMPIUint64 CMGetObjectPathHash(
+    const CMPIObjectPath *op,
+    CMPIStatus *rc)
+{
+    return op->ft->getHash(op, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Test whether two CMPIObjectPath objects reference the same object.
+
+    @param op1 CMPIObjectPath object.
+    @param op2 CMPIObjectPath object that is compared with @p op1.
+    @param [out] rc Function return status (suppressed when NULL).
+    @retval true Both object paths reference the same object.
+    @retval false The object paths reference different objects.
+    @fulldescription CMPIObjectPathFT.equals()
+    @examples See CMGetObjectPathHash()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMObjectPathEquals(op1, op2, rc) \
+    ((op1)->ft->equals((op1), (op2), (rc)))
+#else
+static inline CMPIBoolean CMObjectPathEquals(
+    const CMPIObjectPath *op1,
+    const CMPIObjectPath *op2,
+    CMPIStatus *rc)
+{
+    return op1->ft->equals(op1, op2, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Convert the object path in a CMPIObjectPath object into its
+        canonical binary representation.
+
+    @param op CMPIObjectPath object.
+    @param [out] buf Buffer for the binary representation, or NULL.
+    @param bufSize Size of @p buf in Bytes.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Size of the binary representation in Bytes.
+    @fulldescription CMPIObjectPathFT.toBinary()
+    @examples
+    @code (.c)
+    unsigned char key[256];
+    size_t len = CMObjectPathToBinary(op, key, sizeof(key), &rc);
+
+    if (rc.rc == CMPI_RC_OK && len <= sizeof(key))
+        entry = map_lookup(refmap, key, len);
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMObjectPathToBinary(op, buf, bufSize, rc) \
+    ((op)->ft->toBinary((op), (buf), (bufSize), (rc)))
+#else
+static inline size_t CMObjectPathToBinary(
+    const CMPIObjectPath *op,
+    void *buf,
+    size_t bufSize,
+    CMPIStatus *rc)
+{
+    return op->ft->toBinary(op, buf, bufSize, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Add or replace multiple key bindings in a CMPIObjectPath object.
+
+    @param op CMPIObjectPath object.
+    @param names Array of key binding names.
+    @param values Array of key binding values.
+    @param types Array of key binding types.
+    @param n Number of key bindings.
+    @return Function return status.
+    @fulldescription CMPIObjectPathFT.addKeys()
+    @examples See CMNewObjectPathWithKeys()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMAddKeys(op, names, values, types, n) \
+    ((op)->ft->addKeys((op), (names), (values), (types), (n)))
+#else
+static inline CMPIStatus CMAddKeys(
+    const CMPIObjectPath *op,
+    const char **names,
+    const CMPIValue *values,
+    const CMPIType *types,
+    CMPICount n)
+{
+    return op->ft->addKeys(op, names, values, types, n);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 
 /**
   @}
@@ -2108,6 +2525,48 @@ static inline CMPIBoolean CMEvaluateSelExpUsingAccessor(
 }
 #endif
 
+#ifdef CMPI_VER_220
+/** @brief Test whether each instance in an array of instances matches the
+        select expression in a CMPISelectExp object.
+
+    @param se SelectExp object.
+    @param insts Array of instances to be tested.
+    @param n Number of instances.
+    @param [out] out Array of @p n test results.
+    @return Function return status.
+    @fulldescription CMPISelectExpFT.evaluateBatch()
+    @examples
+    @code (.c)
+    const CMPIInstance *insts[POLL_BATCH];
+    CMPIBoolean match[POLL_BATCH];
+    CMPICount i, n;
+
+    n = poll_devices(insts, POLL_BATCH);
+    rc = CMEvaluateSelExpBatch(filter->se, insts, n, match);
+    for (i = 0; rc.rc == CMPI_RC_OK && i < n; i++) {
+        if (match[i])
+            deliver_indication(filter, insts[i]);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMEvaluateSelExpBatch(se, insts, n, out) \
+    ((se)->ft->evaluateBatch((se), (insts), (n), (out)))
+#else
+static inline CMPIStatus CMEvaluateSelExpBatch(
+    const CMPISelectExp *se,
+    const CMPIInstance *const *insts,
+    CMPICount n,
+    CMPIBoolean *out)
+{
+    return se->ft->evaluateBatch(se, insts, n, out);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 
 /**
   @}
@@ -3014,6 +3473,99 @@ static inline const char** CMGetListProperties(
 #endif
 #endif /* CMPI_VER_210 */
 
+#ifdef CMPI_VER_220
+/** @brief Test whether a property identified by a property handle is in the
+        property list represented by a CMPIPropertyList object.
+
+    @param plist CMPIPropertyList object.
+    @param handle Property handle of the property to be tested.
+    @param [out] rc Function return status (suppressed when NULL).
+    @retval true The property is in the property list, or the function
+        failed.
+    @retval false The property is not in the property list.
+    @fulldescription CMPIPropertyListFT.isPropertyHandleInList()
+    @see CMWantsProperty()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMIsPropertyHandleInList(plist, handle, rc) \
+    ((plist)->ft->isPropertyHandleInList((plist), (handle), (rc)))
+#else
+static inline CMPIBoolean CMIsPropertyHandleInList(
+    const CMPIPropertyList *plist,
+    CMPIPropertyHandle handle,
+    CMPIStatus *rc)
+{
+    return plist->ft->isPropertyHandleInList(plist, handle, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Test whether a property has been requested by the property list
+        of an MI function.
+
+    CMWantsProperty() executes CMPIPropertyListFT.isPropertyHandleInList() on
+    @p plist, except that a NULL @p plist is treated as a property list that
+    contains all properties. This matches the meaning of a NULL
+    @p properties argument of MI functions such as
+    CMPIInstanceMIFT.enumerateInstances(), so that @p plist can be set up
+    once per MI function invocation as shown in the example below.
+
+    CMWantsProperty() fails open: If the function table of @p plist does not
+    provide CMPIPropertyListFT.isPropertyHandleInList() (i.e., the MB
+    supports only CMPI 2.1), or if that function fails (e.g. with
+    `CMPI_RC_ERR_NOT_SUPPORTED` or `CMPI_RC_ERR_INVALID_PARAMETER`), it
+    returns true, so that the MI does not omit properties that may have been
+    requested. Filtering of the returned instances (e.g. using
+    CMSetPropertyFilter()) is still needed in that case.
+
+    @param plist CMPIPropertyList object, or NULL.
+    @param handle Property handle of the property to be tested.
+    @retval true @p plist is NULL, the property is in the property list, or
+        the test could not be performed.
+    @retval false The property is not in the property list.
+    @fulldescription CMPIPropertyListFT.isPropertyHandleInList()
+    @examples
+    The following code fragment of an enumerateInstances() function skips the
+    computation of an expensive property if it has not been requested. The
+    property handle `_hSmartStatus` has been obtained using
+    CMGetPropertyHandle() during the initialization of the MI:
+    @code (.c)
+    CMPIPropertyList *plist = (properties == NULL) ? NULL :
+        CMNewPropertyList(_broker, properties, NULL);
+
+    while (. . .) {
+        inst = CMNewInstance(_broker, . . .);
+        . . .
+        if (CMWantsProperty(plist, _hSmartStatus)) {
+            value.uint16 = read_smart_status(. . .);  // expensive
+            CMSetPropertyH(inst, _hSmartStatus, &value, CMPI_uint16);
+        }
+        CMReturnInstance(rslt, inst);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMWantsProperty(plist, handle) \
+    (!(plist) || (plist)->ft->ftVersion < CMPIVersion220 || \
+     (plist)->ft->isPropertyHandleInList((plist), (handle), NULL))
+#else
+static inline CMPIBoolean CMWantsProperty(
+    const CMPIPropertyList *plist,
+    CMPIPropertyHandle handle)
+{
+    return !plist || plist->ft->ftVersion < CMPIVersion220 ||
+        plist->ft->isPropertyHandleInList(plist, handle, NULL);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 #ifdef CMPI_VER_210
 /** @brief Test whether an instance matches the filter represented by a
         CMPIEnumerationFilter object.
@@ -3042,16 +3594,231 @@ static inline CMPIBoolean CMFilterMatch(
 #endif
 #endif /* CMPI_VER_210 */
 
-/**
-  @}
-  @addtogroup convenience-func-helper
-  @{
-*/
-
-/** @brief Get the MB capabilities
+#ifdef CMPI_VER_220
+/** @brief Test whether each instance in an array of instances matches the
+        filter represented by a CMPIEnumerationFilter object.
 
-    The MB capabilities are defined as bits in the returned integer value. See
-    @ref mb-capabilities "MB Capabilities" for details.
+    @param ef CMPIEnumerationFilter object.
+    @param insts Array of instances to be tested against the filter.
+    @param n Number of instances.
+    @param [out] out Array of @p n test results.
+    @return Function return status.
+    @fulldescription CMPIEnumerationFilterFT.matchBatch()
+    @examples
+    The following code fragment of an enumerateInstancesFiltered() function
+    filters the instances it has collected before returning them. If
+    CMFilterMatchBatch() fails (for example with CMPI_RC_ERR_NOT_SUPPORTED on
+    an MB that does not support it), it falls back to testing each instance
+    using CMFilterMatch():
+    @code (.c)
+    CMPIEnumerationFilter *ef;
+    const CMPIInstance *insts[256];
+    CMPIBoolean match[256];
+    CMPICount i, n;
+
+    ef = CMNewEnumerationFilter(_broker, filterQueryLanguage, filterQuery,
+        &rc);
+    . . .
+    n = collect_instances(insts, 256);
+    rc = CMFilterMatchBatch(ef, insts, n, match);
+    if (rc.rc != CMPI_RC_OK) {
+        rc.rc = CMPI_RC_OK;
+        for (i = 0; rc.rc == CMPI_RC_OK && i < n; i++)
+            match[i] = CMFilterMatch(ef, insts[i], &rc);
+    }
+    if (rc.rc != CMPI_RC_OK)
+        return rc;              // do not silently drop the instances
+    for (i = 0; i < n; i++) {
+        if (match[i])
+            CMReturnInstance(rslt, insts[i]);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMFilterMatchBatch(ef, insts, n, out) \
+    ((ef)->ft->matchBatch((ef), (insts), (n), (out)))
+#else
+static inline CMPIStatus CMFilterMatchBatch(
+    const CMPIEnumerationFilter *ef,
+    const CMPIInstance *const *insts,
+    CMPICount n,
+    CMPIBoolean *out)
+{
+    return ef->ft->matchBatch(ef, insts, n, out);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/**
+  @}
+  @addtogroup convenience-func-edt-filterset
+  @{
+*/
+
+/** @brief Add a select expression to a CMPIFilterSet object.
+
+    @param fs CMPIFilterSet object.
+    @param se SelectExp object to be added.
+    @param id Filter id that identifies the select expression.
+    @return Function return status.
+    @fulldescription CMPIFilterSetFT.addFilter()
+    @examples
+    @code (.c)
+    static CMPIFilterSet *filters;
+    static CMPI_RWLOCK_TYPE filters_lock;
+
+    static CMPIStatus MyProvIndicationInitialize(CMPIIndicationMI *mi,
+        const CMPIContext *ctx)
+    {
+        CMPIStatus rc;
+        CMPIFilterSet *fs = CMNewFilterSet(_broker, &rc);
+
+        if (fs == NULL)
+            return rc;
+        // fs is released automatically when this function returns, so keep
+        // a clone that lives until the cleanup function releases it
+        filters = CMClone(fs, &rc);
+        if (filters == NULL)
+            return rc;
+        filters_lock = _broker->xft->newRWLock(0);
+        CMReturn(CMPI_RC_OK);
+    }
+
+    static CMPIStatus MyProvIndicationCleanup(CMPIIndicationMI *mi,
+        const CMPIContext *ctx, CMPIBoolean terminating)
+    {
+        CMRelease(filters);
+        _broker->xft->destroyRWLock(filters_lock);
+        CMReturn(CMPI_RC_OK);
+    }
+
+    static CMPIStatus MyProvActivateFilter(CMPIIndicationMI *mi,
+        const CMPIContext *ctx, const CMPISelectExp *filter,
+        const char *className, const CMPIObjectPath *classPath,
+        CMPIBoolean firstActivation)
+    {
+        CMPIStatus rc;
+
+        _broker->xft->writeLock(filters_lock);
+        rc = CMAddFilter(filters, filter, my_filter_id(filter));
+        _broker->xft->unlockRW(filters_lock);
+        if (rc.rc == CMPI_RC_ERR_ALREADY_EXISTS && !firstActivation)
+            rc.rc = CMPI_RC_OK;     // repeated activation of the same filter
+        return rc;
+    }
+
+    static CMPIStatus MyProvDeActivateFilter(CMPIIndicationMI *mi,
+        const CMPIContext *ctx, const CMPISelectExp *filter,
+        const char *className, const CMPIObjectPath *classPath,
+        CMPIBoolean lastDeActivation)
+    {
+        CMPIStatus rc = { CMPI_RC_OK, NULL };
+
+        if (lastDeActivation) {
+            _broker->xft->writeLock(filters_lock);
+            rc = CMRemoveFilter(filters, my_filter_id(filter));
+            _broker->xft->unlockRW(filters_lock);
+        }
+        return rc;
+    }
+
+    static void deliver_all(const CMPIContext *ctx, const CMPIInstance *ind)
+    {
+        CMPIArray *ids;
+        CMPICount i, n;
+
+        // A read lock suffices, because concurrent matching is allowed
+        _broker->xft->readLock(filters_lock);
+        ids = CMFilterSetMatch(filters, ind, NULL);
+        _broker->xft->unlockRW(filters_lock);
+        n = ids ? CMGetArrayCount(ids, NULL) : 0;
+
+        for (i = 0; i < n; i++)
+            deliver_to(ctx, CMGetArrayElementAt(ids, i, NULL).value.uint32,
+                ind);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMAddFilter(fs, se, id) \
+    ((fs)->ft->addFilter((fs), (se), (id)))
+#else
+static inline CMPIStatus CMAddFilter(
+    const CMPIFilterSet *fs,
+    const CMPISelectExp *se,
+    CMPIUint32 id)
+{
+    return fs->ft->addFilter(fs, se, id);
+}
+#endif
+
+/** @brief Remove a select expression from a CMPIFilterSet object.
+
+    @param fs CMPIFilterSet object.
+    @param id Filter id of the select expression to be removed.
+    @return Function return status.
+    @fulldescription CMPIFilterSetFT.removeFilter()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMRemoveFilter(fs, id) \
+    ((fs)->ft->removeFilter((fs), (id)))
+#else
+static inline CMPIStatus CMRemoveFilter(
+    const CMPIFilterSet *fs,
+    CMPIUint32 id)
+{
+    return fs->ft->removeFilter(fs, id);
+}
+#endif
+
+/** @brief Determine the select expressions in a CMPIFilterSet object that an
+        instance matches.
+
+    @param fs CMPIFilterSet object.
+    @param inst Instance to be tested.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Array of @ref CMPI_uint32 filter ids of the matching select
+        expressions.
+    @fulldescription CMPIFilterSetFT.match()
+    @examples See CMAddFilter()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMFilterSetMatch(fs, inst, rc) \
+    ((fs)->ft->match((fs), (inst), (rc)))
+#else
+static inline CMPIArray *CMFilterSetMatch(
+    const CMPIFilterSet *fs,
+    const CMPIInstance *inst,
+    CMPIStatus *rc)
+{
+    return fs->ft->match(fs, inst, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+/**
+  @}
+  @addtogroup convenience-func-helper
+  @{
+*/
+
+/** @brief Get the MB capabilities
+
+    The MB capabilities are defined as bits in the returned integer value. See
+    @ref mb-capabilities "MB Capabilities" for details.
     @param mb CMPIBroker structure.
     @return MB capabilities.
     @fulldescription CMPIBrokerFT.brokerCapabilities
@@ -3201,6 +3968,67 @@ static inline CMPIStatus CBDetachThread(
 }
 #endif
 
+#ifdef CMPI_VER_220
+/** @brief Rebind the current thread to the per-request data of another
+        context.
+
+    @param mb CMPIBroker structure.
+    @param ctx CMPIContext object with which the current thread has been
+        attached.
+    @param reqCtx CMPIContext object of the request on whose behalf the
+        current thread will work next.
+    @return Function return status.
+    @fulldescription CMPIBrokerFT.rebindThread()
+    @examples
+    @code (.c)
+    // Worker thread, prepared and attached to the MB once
+    static CMPI_THREAD_RETURN CMPI_THREAD_CDECL worker(void *parm)
+    {
+        struct work_queue *q = (struct work_queue *)parm;
+        struct work_item *item;
+
+        CBAttachThread(_broker, q->ctx);
+        while ((item = next_work_item(q)) != NULL) {
+            CBRebindThread(_broker, q->ctx, item->reqCtx);
+            item->rc = process(q->ctx, item);
+            signal_work_item_done(item);
+        }
+        CBDetachThread(_broker, q->ctx);
+        return (CMPI_THREAD_RETURN)0;
+    }
+
+    // MI function handing its request over to the worker thread
+    static CMPIStatus MyProvEnumInstances(CMPIInstanceMI *mi,
+        const CMPIContext *ctx, const CMPIResult *rslt,
+        const CMPIObjectPath *classPath, const char **properties)
+    {
+        struct work_item item = { ctx, rslt, classPath, properties };
+
+        queue_work_item(&queue, &item);
+        // ctx is valid only until this function returns, so wait for the
+        // worker thread to finish the request
+        wait_work_item_done(&item);
+        return item.rc;
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CBRebindThread(mb, ctx, reqCtx) \
+    ((mb)->bft->rebindThread((mb), (ctx), (reqCtx)))
+#else
+static inline CMPIStatus CBRebindThread(
+    const CMPIBroker *mb,
+    const CMPIContext *ctx,
+    const CMPIContext *reqCtx)
+{
+    return mb->bft->rebindThread(mb, ctx, reqCtx);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 
 /** @brief Request delivery of an indication.
 
@@ -3906,6 +4734,208 @@ static inline CMPIEnumeration *CBReferencesFiltered(
 #endif
 #endif /* CMPI_VER_210 */
 
+#ifdef CMPI_VER_220
+/** @brief Get an existing instance, asynchronously.
+
+    @param mb CMPIBroker structure.
+    @param ctx CMPIContext object.
+    @param instPath Instance path of the instance to be retrieved.
+    @param properties Property list controlling the properties in the returned
+        instance. If @p properties is NULL, all properties will be included.
+    @param cb Completion function that will be called with the instance.
+    @param parm Arbitrary data that will be passed to @p cb.
+    @return Function return status.
+    @fulldescription CMPIBrokerAsyncFT.getInstanceAsync()
+    @examples
+    Fan out to the instances of several other MIs, and wait until all of them
+    have been retrieved:
+    @code (.c)
+    struct fanout {
+        CMPI_MUTEX_TYPE mtx;
+        CMPI_COND_TYPE cond;
+        int pending;
+    };
+
+    static void gotInstance(CMPIStatus rc, CMPIData result, void *parm)
+    {
+        struct fanout *fo = (struct fanout *)parm;
+
+        if (rc.rc == CMPI_RC_OK)
+            aggregate(result.value.inst);
+        _broker->xft->lockMutex2(fo->mtx);
+        if (--fo->pending == 0)
+            _broker->xft->signalCondition(fo->cond);
+        _broker->xft->unlockMutex2(fo->mtx);
+    }
+
+    // ... in the MI function:
+    fo.pending = n;
+    for (i = 0; i < n; i++) {
+        rc = CBGetInstanceAsync(_broker, ctx, parts[i], NULL, gotInstance,
+            &fo);
+        if (rc.rc != CMPI_RC_OK) {
+            _broker->xft->lockMutex2(fo.mtx);
+            fo.pending--;
+            _broker->xft->unlockMutex2(fo.mtx);
+        }
+    }
+    _broker->xft->lockMutex2(fo.mtx);
+    while (fo.pending > 0)
+        _broker->xft->condWait(fo.cond, fo.mtx);
+    _broker->xft->unlockMutex2(fo.mtx);
+    @endcode
+    @capasync
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CBGetInstanceAsync(mb, ctx, instPath, properties, cb, parm) \
+    ((mb)->aft->getInstanceAsync((mb), (ctx), (instPath), (properties), \
+        (cb), (parm)))
+#else
+static inline CMPIStatus CBGetInstanceAsync(
+    const CMPIBroker *mb,
+    const CMPIContext *ctx,
+    const CMPIObjectPath *instPath,
+    const char **properties,
+    CMPICompletionFunc cb,
+    void *parm)
+{
+    return mb->aft->getInstanceAsync(mb, ctx, instPath, properties, cb,
+        parm);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Enumerate the instances of a given class (and subclasses),
+        asynchronously.
+
+    @param mb CMPIBroker structure.
+    @param ctx CMPIContext object.
+    @param classPath Class path of the class to be enumerated.
+    @param properties Property list controlling the properties in the returned
+        instances. If @p properties is NULL, all properties will be included.
+    @param cb Completion function that will be called with the enumeration
+        of instances.
+    @param parm Arbitrary data that will be passed to @p cb.
+    @return Function return status.
+    @fulldescription CMPIBrokerAsyncFT.enumerateInstancesAsync()
+    @examples See CBGetInstanceAsync()
+    @capasync
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CBEnumInstancesAsync(mb, ctx, classPath, properties, cb, parm) \
+    ((mb)->aft->enumerateInstancesAsync((mb), (ctx), (classPath), \
+        (properties), (cb), (parm)))
+#else
+static inline CMPIStatus CBEnumInstancesAsync(
+    const CMPIBroker *mb,
+    const CMPIContext *ctx,
+    const CMPIObjectPath *classPath,
+    const char **properties,
+    CMPICompletionFunc cb,
+    void *parm)
+{
+    return mb->aft->enumerateInstancesAsync(mb, ctx, classPath, properties,
+        cb, parm);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Enumerate the instances associated with a given source instance,
+        asynchronously.
+
+    @param mb CMPIBroker structure.
+    @param ctx CMPIContext object.
+    @param instPath Instance path of the source instance.
+    @param assocClass If not NULL, the association class filtering the result.
+    @param resultClass If not NULL, the class filtering the result.
+    @param role If not NULL, the role of the source instance.
+    @param resultRole If not NULL, the role of the returned instances.
+    @param properties Property list controlling the properties in the returned
+        instances. If @p properties is NULL, all properties will be included.
+    @param cb Completion function that will be called with the enumeration
+        of instances.
+    @param parm Arbitrary data that will be passed to @p cb.
+    @return Function return status.
+    @fulldescription CMPIBrokerAsyncFT.associatorsAsync()
+    @examples See CBGetInstanceAsync()
+    @capasync
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CBAssociatorsAsync(mb, ctx, instPath, assocClass, resultClass, role, \
+            resultRole, properties, cb, parm) \
+    ((mb)->aft->associatorsAsync((mb), (ctx), (instPath), (assocClass), \
+        (resultClass), (role), (resultRole), (properties), (cb), (parm)))
+#else
+static inline CMPIStatus CBAssociatorsAsync(
+    const CMPIBroker *mb,
+    const CMPIContext *ctx,
+    const CMPIObjectPath *instPath,
+    const char *assocClass,
+    const char *resultClass,
+    const char *role,
+    const char *resultRole,
+    const char **properties,
+    CMPICompletionFunc cb,
+    void *parm)
+{
+    return mb->aft->associatorsAsync(mb, ctx, instPath, assocClass,
+        resultClass, role, resultRole, properties, cb, parm);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Invoke a method on a target object, asynchronously.
+
+    @param mb CMPIBroker structure.
+    @param ctx CMPIContext object.
+    @param objPath Object path of the target object.
+    @param method Method name.
+    @param in Method input parameters.
+    @param [out] out Method output parameters, available when @p cb is called.
+    @param cb Completion function that will be called with the method return
+        value.
+    @param parm Arbitrary data that will be passed to @p cb.
+    @return Function return status.
+    @fulldescription CMPIBrokerAsyncFT.invokeMethodAsync()
+    @examples See CBGetInstanceAsync()
+    @capasync
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CBInvokeMethodAsync(mb, ctx, objPath, method, in, out, cb, parm) \
+    ((mb)->aft->invokeMethodAsync((mb), (ctx), (objPath), (method), (in), \
+        (out), (cb), (parm)))
+#else
+static inline CMPIStatus CBInvokeMethodAsync(
+    const CMPIBroker *mb,
+    const CMPIContext *ctx,
+    const CMPIObjectPath *objPath,
+    const char *method,
+    const CMPIArgs *in,
+    CMPIArgs *out,
+    CMPICompletionFunc cb,
+    void *parm)
+{
+    return mb->aft->invokeMethodAsync(mb, ctx, objPath, method, in, out, cb,
+        parm);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 /** @brief Create a new CMPIInstance object initialized to a given instance
         path.
 
@@ -4269,100 +5299,251 @@ static inline CMPIError * CMNewCMPIError(
                                  rc);
 }
 #endif
-#endif /* CMPI_VER_200 */
+#endif /* CMPI_VER_200 */
+
+#ifdef CMPI_VER_210
+/** @brief Create a new CMPIPropertyList object initialized to a list of
+        property names.
+
+    @param mb CMPIBroker structure.
+    @param properties The property names in the property list, in any order and
+        in any lexical case.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return The new CMPIPropertyList object.
+    @fulldescription CMPIBrokerEncFT.newPropertyList()
+    @added210
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMNewPropertyList(mb, properties, rc) \
+    ((mb)->eft->newPropertyList((mb), (properties), (rc)))
+#else
+static inline CMPIPropertyList *CMNewPropertyList(
+    const CMPIBroker *mb,
+    const char **properties,
+    CMPIStatus *rc)
+{
+    return mb->eft->newPropertyList(mb, properties, rc);
+}
+#endif
+#endif /* CMPI_VER_210 */
+
+#ifdef CMPI_VER_210
+/** @brief Create a new CMPIString object from a C-language string in a
+         specific codepage.
+
+    @param mb CMPIBroker structure.
+    @param data C-language string represented in the codepage specified in
+        @p cpid. @p data is used to initialize the new CMPIString object after
+        converting it from its codepage to UTF-8.
+    @param cpid CMPI-specific codepage ID for the codepage that is used to
+        interpret the Bytes in the @p data argument. See @ref CMPICodepageID
+        for a list of supported codepages and their codepage ID values.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return The new CMPIString object.
+    @fulldescription CMPIBrokerEncFT.newStringCP()
+    @added210
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMNewStringCP(mb, data, cpid, rc) \
+    ((mb)->eft->newStringCP((mb), (data), (cpid), (rc)))
+#else
+static inline CMPIString *CMNewStringCP(
+    const CMPIBroker *mb,
+    const char* data,
+    const CMPICodepageID cpid,
+    CMPIStatus *rc)
+{
+    return mb->eft->newStringCP(mb, data, cpid, rc);
+}
+#endif
+#endif /* CMPI_VER_210 */
+
+#ifdef CMPI_VER_210
+/** @brief Create a new CMPIEnumerationFilter object initialized with a
+        filter query.
+
+    @param mb CMPIBroker structure.
+    @param filterQueryLanguage Query language used by @p filterQuery (no
+        filtering when NULL).
+    @param filterQuery Filter query (no filtering when NULL).
+    @param [out] rc Function return status (suppressed when NULL).
+    @return The new CMPIEnumerationFilter object.
+    @fulldescription CMPIBrokerEncFT.newEnumerationFilter()
+    @added210
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMNewEnumerationFilter(mb, filterQueryLanguage, filterQuery, rc) \
+    ((mb)->eft->newEnumerationFilter((mb), (filterQueryLanguage), \
+        (filterQuery), (rc)))
+#else
+static inline CMPIEnumerationFilter *CMNewEnumerationFilter(
+    const CMPIBroker *mb,
+    const char* filterQueryLanguage,
+    const char* filterQuery,
+    CMPIStatus *rc)
+{
+    return mb->eft->newEnumerationFilter(mb, filterQueryLanguage, filterQuery,
+        rc);
+}
+#endif
+#endif /* CMPI_VER_210 */
+
+#ifdef CMPI_VER_220
+/** @brief Create a new CMPIInstance object from an instance template.
+
+    @param mb CMPIBroker structure.
+    @param tmpl Template instance.
+    @param instPath Object path for the new instance (object path of
+        @p tmpl when NULL).
+    @param [out] rc Function return status (suppressed when NULL).
+    @return The new CMPIInstance object.
+    @fulldescription CMPIBrokerEncFT.newInstanceFromTemplate()
+    @examples
+    The following code fragment prepares a template instance once, and
+    creates the instances of an enumeration from it:
+    @code (.c)
+    static CMPIInstance *tmpl;
+    CMPIValue v;
+
+    // . . . once, e.g. in the MI initialization function, where sysName and
+    // sysCcn are CMPIString pointers:
+    inst = CMNewInstance(_broker, classPath, &rc);
+    v.string = sysName;
+    CMSetProperty(inst, "SystemName", &v, CMPI_string);
+    v.string = sysCcn;
+    CMSetProperty(inst, "SystemCreationClassName", &v, CMPI_string);
+    tmpl = CMClone(inst, &rc);
+
+    // . . . in enumerateInstances(), where devices[i].path is a
+    // CMPIObjectPath pointer and devices[i].id is a CMPIString pointer:
+    for (i = 0; i < count; i++) {
+        inst = CMNewInstanceFromTemplate(_broker, tmpl, devices[i].path,
+            &rc);
+        v.string = devices[i].id;
+        CMSetProperty(inst, "DeviceID", &v, CMPI_string);
+        CMReturnInstance(rslt, inst);
+    }
+
+    // . . . in the MI cleanup function:
+    CMRelease(tmpl);
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMNewInstanceFromTemplate(mb, tmpl, instPath, rc) \
+    ((mb)->eft->newInstanceFromTemplate((mb), (tmpl), (instPath), (rc)))
+#else
+static inline CMPIInstance *CMNewInstanceFromTemplate(
+    const CMPIBroker *mb,
+    const CMPIInstance *tmpl,
+    const CMPIObjectPath *instPath,
+    CMPIStatus *rc)
+{
+    return mb->eft->newInstanceFromTemplate(mb, tmpl, instPath, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
 
-#ifdef CMPI_VER_210
-/** @brief Create a new CMPIPropertyList object initialized to a list of
-        property names.
+#ifdef CMPI_VER_220
+/** @brief Create a new CMPIString object that takes ownership of a
+        C-language string.
 
     @param mb CMPIBroker structure.
-    @param properties The property names in the property list, in any order and
-        in any lexical case.
+    @param data C-language string allocated by the MB (e.g. using CMMalloc()),
+        whose ownership is transferred to the new CMPIString object.
     @param [out] rc Function return status (suppressed when NULL).
-    @return The new CMPIPropertyList object.
-    @fulldescription CMPIBrokerEncFT.newPropertyList()
-    @added210
+    @return The new CMPIString object.
+    @fulldescription CMPIBrokerEncFT.newStringAdopt()
+    @examples
+    @code (.c)
+    CMPIValue v;
+    char *buf = CMMalloc(_broker, len + 1);
+    read_log_excerpt(buf, len + 1);       // fills buf
+    v.string = CMNewStringAdopt(_broker, buf, &rc);
+    if (v.string == NULL)
+        CMFree(_broker, buf);             // still owned by the MI
+    else
+        CMSetProperty(inst, "Excerpt", &v, CMPI_string);
+    @endcode
+    @capmemory
+    @added220
     @statusopenpegasus TBD
     @hideinitializer
 */
 #ifdef CMPI_NO_INLINE
-#define CMNewPropertyList(mb, properties, rc) \
-    ((mb)->eft->newPropertyList((mb), (properties), (rc)))
+#define CMNewStringAdopt(mb, data, rc) \
+    ((mb)->eft->newStringAdopt((mb), (data), (rc)))
 #else
-static inline CMPIPropertyList *CMNewPropertyList(
+static inline CMPIString *CMNewStringAdopt(
     const CMPIBroker *mb,
-    const char **properties,
+    char *data,
     CMPIStatus *rc)
 {
-    return mb->eft->newPropertyList(mb, properties, rc);
+    return mb->eft->newStringAdopt(mb, data, rc);
 }
 #endif
-#endif /* CMPI_VER_210 */
+#endif /* CMPI_VER_220 */
 
-#ifdef CMPI_VER_210
-/** @brief Create a new CMPIString object from a C-language string in a
-         specific codepage.
+#ifdef CMPI_VER_220
+/** @brief Create a new CMPIString object that references a C-language
+        string.
 
     @param mb CMPIBroker structure.
-    @param data C-language string represented in the codepage specified in
-        @p cpid. @p data is used to initialize the new CMPIString object after
-        converting it from its codepage to UTF-8.
-    @param cpid CMPI-specific codepage ID for the codepage that is used to
-        interpret the Bytes in the @p data argument. See @ref CMPICodepageID
-        for a list of supported codepages and their codepage ID values.
+    @param data C-language string that shall remain valid and unchanged until
+        the new CMPIString object has been released.
     @param [out] rc Function return status (suppressed when NULL).
     @return The new CMPIString object.
-    @fulldescription CMPIBrokerEncFT.newStringCP()
-    @added210
+    @fulldescription CMPIBrokerEncFT.newStringView()
+    @added220
     @statusopenpegasus TBD
     @hideinitializer
 */
 #ifdef CMPI_NO_INLINE
-#define CMNewStringCP(mb, data, cpid, rc) \
-    ((mb)->eft->newStringCP((mb), (data), (cpid), (rc)))
+#define CMNewStringView(mb, data, rc) \
+    ((mb)->eft->newStringView((mb), (data), (rc)))
 #else
-static inline CMPIString *CMNewStringCP(
+static inline CMPIString *CMNewStringView(
     const CMPIBroker *mb,
-    const char* data,
-    const CMPICodepageID cpid,
+    const char *data,
     CMPIStatus *rc)
 {
-    return mb->eft->newStringCP(mb, data, cpid, rc);
+    return mb->eft->newStringView(mb, data, rc);
 }
 #endif
-#endif /* CMPI_VER_210 */
+#endif /* CMPI_VER_220 */
 
-#ifdef CMPI_VER_210
-/** @brief Create a new CMPIEnumerationFilter object initialized with a
-        filter query.
+#ifdef CMPI_VER_220
+/** @brief Create a new, empty CMPIFilterSet object.
 
     @param mb CMPIBroker structure.
-    @param filterQueryLanguage Query language used by @p filterQuery (no
-        filtering when NULL).
-    @param filterQuery Filter query (no filtering when NULL).
     @param [out] rc Function return status (suppressed when NULL).
-    @return The new CMPIEnumerationFilter object.
-    @fulldescription CMPIBrokerEncFT.newEnumerationFilter()
-    @added210
+    @return The new CMPIFilterSet object.
+    @fulldescription CMPIBrokerEncFT.newFilterSet()
+    @capquerynorm
+    @added220
     @statusopenpegasus TBD
     @hideinitializer
 */
 #ifdef CMPI_NO_INLINE
-#define CMNewEnumerationFilter(mb, filterQueryLanguage, filterQuery, rc) \
-    ((mb)->eft->newEnumerationFilter((mb), (filterQueryLanguage), \
-        (filterQuery), (rc)))
+#define CMNewFilterSet(mb, rc) \
+    ((mb)->eft->newFilterSet((mb), (rc)))
 #else
-static inline CMPIEnumerationFilter *CMNewEnumerationFilter(
+static inline CMPIFilterSet *CMNewFilterSet(
     const CMPIBroker *mb,
-    const char* filterQueryLanguage,
-    const char* filterQuery,
     CMPIStatus *rc)
 {
-    return mb->eft->newEnumerationFilter(mb, filterQueryLanguage, filterQuery,
-        rc);
+    return mb->eft->newFilterSet(mb, rc);
 }
 #endif
-#endif /* CMPI_VER_210 */
+#endif /* CMPI_VER_220 */
 
 /** @brief Test whether a class path is of a specified class or any of its
         subclasses.
@@ -4695,6 +5876,348 @@ static inline CMPIStatus CMCloseMessageFile(
                             args))
 #endif /* CMPI_VER_200 */
 
+#ifdef CMPI_VER_220
+/** @brief Resolve a property name of a class to a property handle.
+
+    @param mb CMPIBroker structure.
+    @param classPath Class path of the class.
+    @param name Property name.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Property handle.
+    @fulldescription CMPIBrokerEncFT.getPropertyHandle()
+    @examples
+    The following code fragment resolves property handles once in the
+    initialization of an instance MI, and uses them when building instances:
+    @code (.c)
+    static CMPIPropertyHandle hName, hSize;
+
+    static CMPIStatus MyProvInstanceInitialize(
+        CMPIInstanceMI *mi,
+        const CMPIContext *ctx)
+    {
+        CMPIStatus st;
+        CMPIObjectPath *cop = CMNewObjectPath(_broker, "root/cimv2",
+            "MY_Disk", &st);
+        if (st.rc != CMPI_RC_OK)
+            return st;
+        hName = CMGetPropertyHandle(_broker, cop, "Name", &st);
+        if (st.rc != CMPI_RC_OK)
+            return st;
+        hSize = CMGetPropertyHandle(_broker, cop, "Size", &st);
+        return st;
+    }
+
+    // . . . in enumerateInstances(), for each disk:
+    CMPIValue name, size;   // name.string and size.uint64 set for the disk
+    inst = CMNewInstance(_broker, classPath, &rc);
+    CMSetPropertyH(inst, hName, &name, CMPI_string);
+    CMSetPropertyH(inst, hSize, &size, CMPI_uint64);
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMGetPropertyHandle(mb, classPath, name, rc) \
+    ((mb)->eft->getPropertyHandle((mb), (classPath), (name), (rc)))
+#else
+static inline CMPIPropertyHandle CMGetPropertyHandle(
+    const CMPIBroker *mb,
+    const CMPIObjectPath *classPath,
+    const char *name,
+    CMPIStatus *rc)
+{
+    return mb->eft->getPropertyHandle(mb, classPath, name, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Serialize a CMPI encapsulated data type object into a binary
+        representation.
+
+    @param mb CMPIBroker structure.
+    @param value Value containing the object to be serialized.
+    @param type Type of the object: @ref CMPI_instance, @ref CMPI_ref,
+        @ref CMPI_args, or an array type.
+    @param [out] buf Buffer for the binary representation, or NULL.
+    @param bufSize Size of @p buf in Bytes.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return Size of the binary representation in Bytes.
+    @fulldescription CMPIBrokerEncFT.serialize()
+    @examples
+    @code (.c)
+    CMPIValue value;
+    size_t size;
+    void *blob;
+
+    value.inst = inst;
+    size = CMSerialize(_broker, &value, CMPI_instance, NULL, 0, &rc);
+    blob = malloc(size);
+    CMSerialize(_broker, &value, CMPI_instance, blob, size, &rc);
+    cache_store(key, blob, size);
+    // ... later, possibly after a restart of the MB:
+    CMPIData d = CMDeserialize(_broker, blob, size, &rc);
+    if (rc.rc == CMPI_RC_OK && d.type == CMPI_instance)
+        CMReturnInstance(rslt, d.value.inst);
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMSerialize(mb, value, type, buf, bufSize, rc) \
+    ((mb)->eft->serialize((mb), (value), (type), (buf), (bufSize), (rc)))
+#else
+static inline size_t CMSerialize(
+    const CMPIBroker *mb,
+    const CMPIValue *value,
+    CMPIType type,
+    void *buf,
+    size_t bufSize,
+    CMPIStatus *rc)
+{
+    return mb->eft->serialize(mb, value, type, buf, bufSize, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Create a new CMPI encapsulated data type object from its binary
+        representation.
+
+    @param mb CMPIBroker structure.
+    @param buf Binary representation created by CMSerialize().
+    @param size Size of the binary representation in Bytes.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return CMPIData structure containing the new object.
+    @fulldescription CMPIBrokerEncFT.deserialize()
+    @examples See CMSerialize()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMDeserialize(mb, buf, size, rc) \
+    ((mb)->eft->deserialize((mb), (buf), (size), (rc)))
+#else
+static inline CMPIData CMDeserialize(
+    const CMPIBroker *mb,
+    const void *buf,
+    size_t size,
+    CMPIStatus *rc)
+{
+    return mb->eft->deserialize(mb, buf, size, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Write a set of instances into a persistent snapshot.
+
+    @param mb CMPIBroker structure.
+    @param name Name of the snapshot.
+    @param insts Array of instances to be written.
+    @param n Number of instances.
+    @return Function return status.
+    @fulldescription CMPIBrokerEncFT.writeSnapshot()
+    @examples
+    @code (.c)
+    static const CMPIInstance **devices;  // device table, ndevices entries
+    static CMPIEnumeration *cached;   // never iterated, only cloned
+
+    static CMPIStatus MyProvCleanup(CMPIInstanceMI *mi,
+        const CMPIContext *ctx, CMPIBoolean terminating)
+    {
+        CMWriteSnapshot(_broker, "MyProv.devices", devices, ndevices);
+        // ... free the device table
+        if (cached != NULL)
+            CMRelease(cached);          // ends the sharing of the snapshot
+        CMReturn(CMPI_RC_OK);
+    }
+
+    static CMPIStatus MyProvInstanceInitialize(CMPIInstanceMI *mi,
+        const CMPIContext *ctx)
+    {
+        CMPIStatus rc = { CMPI_RC_OK, NULL };
+        CMPIEnumeration *snap = CMReadSnapshot(_broker, "MyProv.devices", &rc);
+
+        if (rc.rc == CMPI_RC_OK)
+            cached = CMClone(snap, NULL);   // shares the snapshot; keep it
+        start_device_probe();
+        CMReturn(CMPI_RC_OK);
+    }
+
+    static CMPIStatus MyProvEnumInstances(CMPIInstanceMI *mi,
+        const CMPIContext *ctx, const CMPIResult *rslt,
+        const CMPIObjectPath *classPath, const char **properties)
+    {
+        CMPIEnumeration *en;
+
+        if (device_probe_done() || cached == NULL)
+            return enum_probed_devices(ctx, rslt, classPath, properties);
+
+        // Cheap per-request iterator; decodes only the instances it returns
+        en = CMClone(cached, NULL);
+        while (CMHasNext(en, NULL))
+            CMReturnInstance(rslt, CMGetNext(en, NULL).value.inst);
+        CMRelease(en);
+        CMReturnDone(rslt);
+        CMReturn(CMPI_RC_OK);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMWriteSnapshot(mb, name, insts, n) \
+    ((mb)->eft->writeSnapshot((mb), (name), (insts), (n)))
+#else
+static inline CMPIStatus CMWriteSnapshot(
+    const CMPIBroker *mb,
+    const char *name,
+    const CMPIInstance *const *insts,
+    CMPICount n)
+{
+    return mb->eft->writeSnapshot(mb, name, insts, n);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Read the instances of a persistent snapshot.
+
+    @param mb CMPIBroker structure.
+    @param name Name of the snapshot.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return New CMPIEnumeration object containing the instances.
+    @fulldescription CMPIBrokerEncFT.readSnapshot()
+    @examples See CMWriteSnapshot()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMReadSnapshot(mb, name, rc) \
+    ((mb)->eft->readSnapshot((mb), (name), (rc)))
+#else
+static inline CMPIEnumeration *CMReadSnapshot(
+    const CMPIBroker *mb,
+    const char *name,
+    CMPIStatus *rc)
+{
+    return mb->eft->readSnapshot(mb, name, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Remove a persistent snapshot.
+
+    @param mb CMPIBroker structure.
+    @param name Name of the snapshot.
+    @return Function return status.
+    @fulldescription CMPIBrokerEncFT.removeSnapshot()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMRemoveSnapshot(mb, name) \
+    ((mb)->eft->removeSnapshot((mb), (name)))
+#else
+static inline CMPIStatus CMRemoveSnapshot(
+    const CMPIBroker *mb,
+    const char *name)
+{
+    return mb->eft->removeSnapshot(mb, name);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Create a new CMPIObjectPath object from the canonical binary
+        representation of an object path.
+
+    @param mb CMPIBroker structure.
+    @param buf Binary representation created by CMObjectPathToBinary().
+    @param size Size of the binary representation in Bytes.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return The new CMPIObjectPath object.
+    @fulldescription CMPIBrokerEncFT.newObjectPathFromBinary()
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMNewObjectPathFromBinary(mb, buf, size, rc) \
+    ((mb)->eft->newObjectPathFromBinary((mb), (buf), (size), (rc)))
+#else
+static inline CMPIObjectPath *CMNewObjectPathFromBinary(
+    const CMPIBroker *mb,
+    const void *buf,
+    size_t size,
+    CMPIStatus *rc)
+{
+    return mb->eft->newObjectPathFromBinary(mb, buf, size, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
+#ifdef CMPI_VER_220
+/** @brief Create a new CMPIObjectPath object initialized to a given
+        namespace, class name and key bindings.
+
+    @param mb CMPIBroker structure.
+    @param ns Namespace name.
+    @param cn Class name.
+    @param names Array of key binding names.
+    @param values Array of key binding values.
+    @param types Array of key binding types.
+    @param n Number of key bindings.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return The new CMPIObjectPath object.
+    @fulldescription CMPIBrokerEncFT.newObjectPathWithKeys()
+    @examples
+    @code (.c)
+    static const char *keyNames[] = { "CreationClassName", "DeviceID" };
+    static const CMPIType keyTypes[] = { CMPI_chars, CMPI_chars };
+    CMPIValue keyValues[2];
+
+    keyValues[0].chars = "MyProv_Device";
+    for (i = 0; i < ndevices; i++) {
+        keyValues[1].chars = devices[i].id;
+        op = CMNewObjectPathWithKeys(_broker, ns, "MyProv_Device", keyNames,
+            keyValues, keyTypes, 2, &rc);
+        CMReturnObjectPath(rslt, op);
+    }
+    @endcode
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMNewObjectPathWithKeys(mb, ns, cn, names, values, types, n, rc) \
+    ((mb)->eft->newObjectPathWithKeys((mb), (ns), (cn), (names), (values), \
+        (types), (n), (rc)))
+#else
+static inline CMPIObjectPath *CMNewObjectPathWithKeys(
+    const CMPIBroker *mb,
+    const char *ns,
+    const char *cn,
+    const char **names,
+    const CMPIValue *values,
+    const CMPIType *types,
+    CMPICount n,
+    CMPIStatus *rc)
+{
+    return mb->eft->newObjectPathWithKeys(mb, ns, cn, names, values, types,
+        n, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 #ifdef CMPI_VER_210
 /** @brief Mark a new object lifecycle level for subsequent newly created
         CMPI encapsulated data type objects.
@@ -5256,6 +6779,50 @@ static inline void CMFreeChars(
 #endif
 #endif /* CMPI_VER_210 */
 
+#ifdef CMPI_VER_220
+/** @brief Mark a new arena-scoped object lifecycle level for subsequent
+        newly created CMPI encapsulated data type objects.
+
+    @param mb CMPIBroker structure.
+    @param [out] rc Function return status (suppressed when NULL).
+    @return @ref CMPIGcStat structure for use with CMPIBrokerMemFT.release().
+    @fulldescription CMPIBrokerMemFT.markArena()
+    @examples
+    The following code fragment creates short-lived objects while polling,
+    and reclaims all of them at once:
+    @code (.c)
+    CMPIBroker *_broker;
+    CMPIStatus st;
+    CMPIGcStat *gc;
+
+    gc = CMMemMarkArena(_broker, &st);    // marks arena-scoped level #1
+
+    i1 = CMNewInstance(_broker, . . .);   // allocated from the arena
+    s1 = CMNewString(_broker, . . .);     // allocated from the arena
+
+    i2 = CMClone(i1, &st);                // not allocated from the arena
+
+    st = CMMemRelease(_broker, gc);       // reclaims i1 and s1 at once;
+                                          // i2 remains valid
+    @endcode
+    @capmemarena
+    @added220
+    @statusopenpegasus TBD
+    @hideinitializer
+*/
+#ifdef CMPI_NO_INLINE
+#define CMMemMarkArena(mb, rc) \
+    ((mb)->mft->markArena((mb), (rc)))
+#else
+static inline CMPIGcStat * CMMemMarkArena(
+    const CMPIBroker *mb,
+    CMPIStatus *rc)
+{
+    return mb->mft->markArena(mb, rc);
+}
+#endif
+#endif /* CMPI_VER_220 */
+
 /**
     @defgroup cmfmt-args CMFmtArgs\<N\>()
     @{
@@ -5407,10 +6974,19 @@ static inline void CMFreeChars(
         <TD>CMPIInstanceMIFT.execQuery()</TD><TD>1.0</TD></TR>
     <TR><TD>\<pfx\>EnumInstancesFiltered()</TD>
         <TD>CMPIInstanceMIFT.enumerateInstancesFiltered()</TD><TD>2.1</TD></TR>
+    <TR><TD>\<pfx\>EnumInstancesPaged()</TD>
+        <TD>CMPIInstanceMIFT.enumerateInstancesPaged()</TD><TD>2.2 (opt-in)
+        </TD></TR>
     </TABLE>
     @note For historical reasons, the name of the \<pfx\>Cleanup() function is
         not following the format \<pfx\>\<mitype\>Cleanup() used for the
         cleanup functions of the other MI types.
+    @note The \<pfx\>EnumInstancesPaged() function is optional: Only if the
+        symbol `CMPI_STUB_ENUM_INSTANCES_PAGED` is defined before
+        including `cmpimacs.h`, the MI needs to provide it and it is put into
+        the function table. Otherwise, the function table entry is set to NULL,
+        and the MB uses \<pfx\>EnumInstances() instead. This allows existing
+        MIs to be compiled for CMPI 2.2 without changes.
     @param pfx The prefix for all functions in the MI function table.
         This is a character string without quotes.
     @param miname The MI name for this MI.
@@ -5518,6 +7094,7 @@ static CMPIInstanceMIFT instMIFT__ = { \
     pfx##DeleteInstance, \
     pfx##ExecQuery, \
     _CMInstanceMIStub_EnumInstancesFiltered(pfx) \
+    _CMInstanceMIStub_EnumInstancesPaged(pfx) \
 }; \
 CMPI_EXTERN_C CMPIInstanceMI * miname##_Create_InstanceMI( \
     const CMPIBroker *mb, \
@@ -6196,6 +7773,18 @@ do { \
 #define _CMIndicationMIStub_DeActivateFilterCollection(pfx)
 #endif
 
+#ifdef CMPI_VER_220
+#ifdef CMPI_STUB_ENUM_INSTANCES_PAGED
+#define _CMInstanceMIStub_EnumInstancesPaged(pfx) \
+    pfx##EnumInstancesPaged,
+#else
+#define _CMInstanceMIStub_EnumInstancesPaged(pfx) \
+    NULL,
+#endif
+#else
+#define _CMInstanceMIStub_EnumInstancesPaged(pfx)
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -6249,6 +7838,7 @@ CMPI_EXTERN_C CMPIInstanceMI *miname##_Create_InstanceMI( \
         CmpiInstanceMI::driveDeleteInstance, \
         CmpiInstanceMI::driveExecQuery, \
         _CMInstanceMIFactory_EnumInstancesFiltered \
+        _CMInstanceMIFactory_EnumInstancesPaged \
     }; \
     static CMPIInstanceMI mi; \
     CmpiContext ctx((CMPIContext *)ctxp); \
@@ -6542,6 +8132,18 @@ CMPI_EXTERN_C CMPIIndicationMI *miname##_Create_IndicationMI( \
 #define _CMIndicationMIFactory_DeActivateFilterCollection
 #endif
 
+#ifdef CMPI_VER_220
+#ifdef CMPI_STUB_ENUM_INSTANCES_PAGED
+#define _CMInstanceMIFactory_EnumInstancesPaged \
+    CmpiInstanceMI::driveEnumInstancesPaged,
+#else
+#define _CMInstanceMIFactory_EnumInstancesPaged \
+    NULL,
+#endif
+#else
+#define _CMInstanceMIFactory_EnumInstancesPaged
+#endif
+
 /** @brief CMProviderBase macro
 
     @param miname MI name
@@ -143,6 +143,45 @@
  */
 #define CMPI_COND_TYPE          void*
 
+/**
+ * @}
+ * @addtogroup sym-task-type
+ * @{
+ */
+
+/**
+ * @brief Type for the handle of a task submitted to the MB thread pool.
+ *
+ * @added220
+ */
+#define CMPI_TASK_TYPE          void*
+
+/**
+ * @}
+ * @addtogroup sym-rwlock-type
+ * @{
+ */
+
+/**
+ * @brief Type for the handle of a reader-writer lock.
+ *
+ * @added220
+ */
+#define CMPI_RWLOCK_TYPE        void*
+
+/**
+ * @}
+ * @addtogroup sym-atomic-type
+ * @{
+ */
+
+/**
+ * @brief Type for an integer that is accessed using atomic operations.
+ *
+ * @added220
+ */
+#define CMPI_ATOMIC_TYPE        long
+
 /**
  * @}
  */